@@ -70,24 +70,31 @@ const AnimSetResource* AnimLibrary::load(AnimSetId id) {
 
     buildKeyToIdx(res);
     buildAnimSolver(res);
+    buildKeyBuckets(res);
     return res;
   });
 }
 
 void AnimLibrary::unload(AnimSetId id) {
   const auto* res = get(id);
+  TextureId tex = kInvalidResourceId;
+  AnimColliderProfileId colliderProfile = kInvalidResourceId;
 
   if (res) {
-    if (res->tex) {
-      RL_TEXLIB.unload(res->tex);
-    }
+    tex = res->tex;
+    colliderProfile = res->colliderProfile;
+  }
 
-    if (res->colliderProfile) {
-      RL_ANIMCOLLIB.unload(res->colliderProfile);
-    }
+  // Case: load() only takes the dependencies for the first reference.
+  if (!slots_.release(id)) return;
+
+  if (tex) {
+    RL_TEXLIB.unload(tex);
   }
 
-  slots_.release(id);
+  if (colliderProfile) {
+    RL_ANIMCOLLIB.unload(colliderProfile);
+  }
 }
 
 const AnimSetResource* AnimLibrary::get(AnimSetId id) const {
@@ -125,4 +132,28 @@ void AnimLibrary::buildAnimSolver(AnimSetResource* set) {
 
   set->solver = AnimSolver{std::move(map)};
 }
+
+void AnimLibrary::buildKeyBuckets(AnimSetResource* set) {
+  for (auto& a : set->anims) {
+    auto frameCount = static_cast<AnimFrame>(a.samples.size());
+    std::stable_sort(
+        a.keys.begin(), a.keys.end(),
+        [](const auto& l, const auto& r) { return l.frame < r.frame; });
+
+    a.keyOffsets.assign(frameCount + 1, 0);
+    usize k = 0;
+
+    for (AnimFrame f = 0; f < frameCount; ++f) {
+      a.keyOffsets[f] = static_cast<u32>(k);
+      while (k < a.keys.size() && a.keys[k].frame == f) ++k;
+    }
+
+    a.keyOffsets[frameCount] = static_cast<u32>(k);
+
+    // Case: keys past the last sample can never be reached by playback.
+    RL_ASSERT(k == a.keys.size(),
+              "AnimLibrary::buildKeyBuckets: Key frame out of range in anim: ",
+              a.key, "!");
+  }
+}
 }  // namespace rl
\ No newline at end of file
@@ -40,6 +40,7 @@ class AnimLibrary {
 
   void buildKeyToIdx(AnimSetResource* set);
   void buildAnimSolver(AnimSetResource* set);
+  void buildKeyBuckets(AnimSetResource* set);
 };
 }  // namespace rl
 
@@ -37,7 +37,13 @@ struct AnimResource {
   AnimKey key{kInvalidAnimKey};
   std::vector<AnimSampleResource> samples{};
   std::vector<AnimDuration> accDurations{};
-  std::vector<AnimKeyFrame> keys{};
+  std::vector<AnimKeyFrame> keys{};  // Sorted by frame at load time.
+  std::vector<u32> keyOffsets{};     // keys[keyOffsets[f], keyOffsets[f + 1]).
+
+  std::span<const AnimKeyFrame> keysAt(AnimFrame f) const noexcept {
+    if (f + 1 >= keyOffsets.size()) return {};
+    return {keys.data() + keyOffsets[f], keys.data() + keyOffsets[f + 1]};
+  }
 };
 
 struct AnimSolvedEntry {
@@ -22,6 +22,7 @@
 #include "engine/core/color.h"
 #include "engine/core/handle.h"
 #include "engine/physics/physics.h"
+#include "engine/relevance/relevance_type.h"
 #include "engine/resource/resource_type.h"
 #include "engine/sprite/sprite.h"
 #include "engine/texture/texture_resource.h"
@@ -52,6 +53,14 @@ struct AnimEventListener {
   void* userData{nullptr};
 };
 
+struct AnimEventListenerKey {
+  u32 animator{static_cast<u32>(-1)};
+  AnimTag tag{kInvalidAnimTag};
+  AnimKeyTag keyTag{kInvalidAnimKeyTag};
+
+  bool operator==(const AnimEventListenerKey&) const = default;
+};
+
 struct AnimState {
   AnimFlags flags{kAnimFlagBitsNone};
   AnimTag tag{kInvalidAnimTag};
@@ -110,44 +119,112 @@ enum AnimatorStateFlagBits : AnimatorStateFlags {
   kAnimatorStateFlagBitsFinished = 0x1,
   kAnimatorStateFlagBitsSentEndEvent = 0x2,
   kAnimatorStateFlagBitsFlipped = 0x4,
+  kAnimatorStateFlagBitsAlive = 0x8,
+  kAnimatorStateFlagBitsDirty = 0x10,
+  kAnimatorStateFlagBitsStep = 0x20,
   kAnimatorStateFlagBitsAll = static_cast<AnimatorStateFlags>(-1),
 };
 
+struct AnimatorFrame {
+  bool flipped{false};
+  TextureId tex{kInvalidResourceId};
+  Sprite sprite{};
+  Rgba colorMod{kRgbaWhite};
+};
+
+// Cold state: touched on playback changes and frame resolves only.
 struct Animator {
-  AnimatorStateFlags stateFlags{kAnimatorStateFlagBitsNone};
   AnimState animState{};
   AnimDirState dirState{};
   AnimatorHandle handle{kInvalidHandle};
   AnimSetId animSet{kInvalidResourceId};
-  Rgba colorMod{kRgbaWhite};
-  AnimDuration startTime{.0f};
-  AnimSpeed speed{1.0f};
-  AnimDuration uTime{.0f};
+  const AnimSetResource* set{nullptr};
   f32 progress{.0f};
-  AnimFrame currentFrame{kInvalidAnimFrame};
-  AnimEventListenerId listenerIdCounter{0};
+  u32 listenerCount{0};
   std::vector<Rgba> colorMods{kRgbaWhite};
-  std::vector<AnimEventListener> listeners{};
+  AnimatorFrame frame{};
+};
 
-  constexpr bool finished() const noexcept {
-    return stateFlags & kAnimatorStateFlagBitsFinished;
+// Hot state: advanced every tick by a single batch pass, so it is stored as
+// one array per field, indexed by animator handle index.
+struct AnimatorHotState {
+  std::vector<AnimatorStateFlags> flags{};
+  std::vector<AnimDuration> startTimes{};
+  std::vector<AnimSpeed> speeds{};
+  std::vector<AnimDuration> uTimes{};
+  std::vector<AnimDuration> prevUTimes{};
+  std::vector<AnimFrame> frames{};
+  std::vector<RelevanceTier> tiers{};
+
+  usize size() const noexcept { return flags.size(); }
+
+  void reserve(usize capacity) {
+    flags.reserve(capacity);
+    startTimes.reserve(capacity);
+    speeds.reserve(capacity);
+    uTimes.reserve(capacity);
+    prevUTimes.reserve(capacity);
+    frames.reserve(capacity);
+    tiers.reserve(capacity);
   }
 
-  constexpr bool sentEndEvent() const noexcept {
-    return stateFlags & kAnimatorStateFlagBitsSentEndEvent;
+  void resize(usize size) {
+    flags.resize(size, kAnimatorStateFlagBitsNone);
+    startTimes.resize(size, .0f);
+    speeds.resize(size, 1.0f);
+    uTimes.resize(size, .0f);
+    prevUTimes.resize(size, .0f);
+    frames.resize(size, kInvalidAnimFrame);
+    tiers.resize(size, RelevanceTier::Full);
   }
 
-  constexpr bool flipped() const noexcept {
-    return stateFlags & kAnimatorStateFlagBitsFlipped;
+  void reset(usize i) {
+    flags[i] = kAnimatorStateFlagBitsNone;
+    startTimes[i] = .0f;
+    speeds[i] = 1.0f;
+    uTimes[i] = .0f;
+    prevUTimes[i] = .0f;
+    frames[i] = kInvalidAnimFrame;
+    tiers[i] = RelevanceTier::Full;
   }
-};
 
-struct AnimatorFrame {
-  bool flipped{false};
-  TextureId tex{kInvalidResourceId};
-  Sprite sprite{};
-  Rgba colorMod{kRgbaWhite};
+  void clear() {
+    flags.clear();
+    startTimes.clear();
+    speeds.clear();
+    uTimes.clear();
+    prevUTimes.clear();
+    frames.clear();
+    tiers.clear();
+  }
+
+  bool alive(usize i) const noexcept {
+    return flags[i] & kAnimatorStateFlagBitsAlive;
+  }
+
+  bool finished(usize i) const noexcept {
+    return flags[i] & kAnimatorStateFlagBitsFinished;
+  }
+
+  bool sentEndEvent(usize i) const noexcept {
+    return flags[i] & kAnimatorStateFlagBitsSentEndEvent;
+  }
+
+  bool flipped(usize i) const noexcept {
+    return flags[i] & kAnimatorStateFlagBitsFlipped;
+  }
 };
 }  // namespace rl
 
+namespace std {
+template <>
+struct hash<::rl::AnimEventListenerKey> {
+  std::size_t operator()(const ::rl::AnimEventListenerKey& k) const noexcept {
+    auto tags = (static_cast<std::size_t>(k.tag) << 32) ^ k.keyTag;
+    constexpr std::size_t kGolden = 0x9e3779b97f4a7c15ULL;
+    return tags ^ (static_cast<std::size_t>(k.animator) * kGolden);
+  }
+};
+}  // namespace std
+
 #endif  // ENGINE_ANIM_ANIM_RUNTIME_H_
@@ -27,6 +27,7 @@
 #include "engine/core/param_traversal.h"
 #include "engine/core/value_utils.h"
 #include "engine/core/vector.h"
+#include "engine/relevance/relevance_system.h"
 
 namespace rl {
 AnimSystem& AnimSystem::instance() {
@@ -40,70 +41,308 @@ void AnimSystem::init() {
   hAnimatorPool_.clear();
   hAnimatorPool_.reserve(kAnimatorCapacity);
   animators_.reserve(kAnimatorCapacity);
+  hot_.reserve(kAnimatorCapacity);
 }
 
 void AnimSystem::shutdown() {
   RL_LOG_DEBUG("AnimSystem::shutdown");
   hAnimatorPool_.clear();
   animators_.clear();
+  hot_.clear();
+  frameChanges_.clear();
+  listeners_.clear();
+  listenerKeys_.clear();
+  listenerIdCounter_ = 0;
+}
+
+void AnimSystem::save(SnapshotWriter& w) const {
+  w.write(globalTime_);
+  hAnimatorPool_.save(w);
+  w.write(static_cast<u32>(animators_.size()));
+
+  for (const auto& a : animators_) {
+    w.write(a.animState);
+    w.write(a.dirState);
+    w.write(a.handle);
+    w.write(a.animSet);
+    w.write(a.progress);
+    w.write(a.frame);
+    w.write(a.colorMods);
+  }
+
+  w.write(hot_.flags);
+  w.write(hot_.startTimes);
+  w.write(hot_.speeds);
+  w.write(hot_.uTimes);
+  w.write(hot_.prevUTimes);
+  w.write(hot_.frames);
+  w.write(hot_.tiers);
+  w.write(frameChanges_);
+}
+
+bool AnimSystem::restore(SnapshotReader& r) {
+  // Anim-set references belong to live animators and are not saved: the ones
+  // held before and after the restore are diffed once it is read.
+  std::vector<AnimSetId> held{};
+
+  for (const auto& a : animators_) {
+    if (a.set && hAnimatorPool_.alive(a.handle)) held.push_back(a.animSet);
+  }
+
+  u32 count{0};
+  if (!r.read(globalTime_) || !hAnimatorPool_.restore(r) || !r.read(count)) {
+    return false;
+  }
+
+  animators_.resize(count);
+
+  for (auto& a : animators_) {
+    if (!r.read(a.animState) || !r.read(a.dirState) || !r.read(a.handle) ||
+        !r.read(a.animSet) || !r.read(a.progress) || !r.read(a.frame) ||
+        !r.read(a.colorMods)) {
+      return false;
+    }
+
+    a.set = nullptr;
+    a.listenerCount = 0;
+  }
+
+  if (!r.read(hot_.flags) || !r.read(hot_.startTimes) ||
+      !r.read(hot_.speeds) || !r.read(hot_.uTimes) ||
+      !r.read(hot_.prevUTimes) || !r.read(hot_.frames) ||
+      !r.read(hot_.tiers) || !r.read(frameChanges_)) {
+    return false;
+  }
+
+  std::vector<AnimSetId> wanted{};
+
+  for (const auto& a : animators_) {
+    if (hAnimatorPool_.alive(a.handle)) wanted.push_back(a.animSet);
+  }
+
+  // Take the references of animators destroyed since the snapshot before
+  // dropping the ones of animators created since, so a set both share is
+  // not released and loaded again.
+  auto byId = [](AnimSetId a, AnimSetId b) { return a.id < b.id; };
+  std::sort(held.begin(), held.end(), byId);
+  std::sort(wanted.begin(), wanted.end(), byId);
+  std::vector<AnimSetId> diff{};
+  std::set_difference(wanted.begin(), wanted.end(), held.begin(), held.end(),
+                      std::back_inserter(diff), byId);
+  for (auto id : diff) RL_ANIMLIB.load(id);
+  diff.clear();
+  std::set_difference(held.begin(), held.end(), wanted.begin(), wanted.end(),
+                      std::back_inserter(diff), byId);
+  for (auto id : diff) RL_ANIMLIB.unload(id);
+
+  for (auto& a : animators_) {
+    if (hAnimatorPool_.alive(a.handle)) a.set = RL_ANIMLIB.get(a.animSet);
+  }
+
+  // Case: listeners are registered by code, not saved. Keep the ones whose
+  // animator survived the restore and drop the rest.
+  auto dead = [this](u32 idx) {
+    return idx >= animators_.size() ||
+           !hAnimatorPool_.alive(animators_[idx].handle);
+  };
+
+  std::erase_if(listenerKeys_,
+                [&dead](const auto& p) { return dead(p.second.animator); });
+
+  for (auto& [key, ls] : listeners_) {
+    if (dead(key.animator)) ls.clear();
+  }
+
+  for (const auto& [id, key] : listenerKeys_) {
+    ++animators_[key.animator].listenerCount;
+  }
+
+  return true;
 }
 
 void AnimSystem::tick(const FramePacket& f) {
   globalTime_ += static_cast<AnimDuration>(f.step);
-  if (animators_.empty()) return;
+  frameChanges_.clear();
+  auto count = hot_.size();
+  if (count == 0) return;
 
-  for (auto& a : animators_) {
-    if (!hAnimatorPool_.alive(a.handle)) continue;
-    if (a.finished()) continue;
-    const auto* set = RL_ANIMLIB.get(a.animSet);
-    const auto& state = a.animState;
-    const auto& anim = set->anims[state.idx];
-    auto duration = anim.duration;
-
-    if (anim.samples.empty() || duration <= .0f) {
-      a.currentFrame = 0;
-      continue;
+  advanceTimes(RL_CRELEVSYS.tickCount());
+
+  for (usize i = 0; i < count; ++i) {
+    if (!(hot_.flags[i] & kAnimatorStateFlagBitsStep)) continue;
+    hot_.flags[i] &= ~kAnimatorStateFlagBitsStep;
+    stepAnimator(animators_[i], i);
+  }
+
+  constexpr AnimatorStateFlags kResolveMask =
+      kAnimatorStateFlagBitsAlive | kAnimatorStateFlagBitsDirty;
+
+  for (usize i = 0; i < count; ++i) {
+    if ((hot_.flags[i] & kResolveMask) != kResolveMask) continue;
+    resolveAnimator(animators_[i], i);
+  }
+}
+
+void AnimSystem::advanceTimes(Frame tick) {
+  constexpr AnimatorStateFlags kRunMask =
+      kAnimatorStateFlagBitsAlive | kAnimatorStateFlagBitsFinished;
+
+  auto count = hot_.size();
+  auto* flags = hot_.flags.data();
+  const auto* startTimes = hot_.startTimes.data();
+  const auto* speeds = hot_.speeds.data();
+  const auto* tiers = hot_.tiers.data();
+  auto* uTimes = hot_.uTimes.data();
+  auto* prevUTimes = hot_.prevUTimes.data();
+  auto t = globalTime_;
+
+  // Case: time is analytic, so animators skipped by their relevance tier
+  // simply cover a longer span on their next step.
+  for (usize i = 0; i < count; ++i) {
+    auto running = (flags[i] & kRunMask) == kAnimatorStateFlagBitsAlive;
+    auto step = running && relevantTick(tiers[i], tick, static_cast<u32>(i));
+    auto u = std::max(.0f, (t - startTimes[i]) * speeds[i]);
+    prevUTimes[i] = step ? uTimes[i] : prevUTimes[i];
+    uTimes[i] = step ? u : uTimes[i];
+    flags[i] |= step ? kAnimatorStateFlagBitsStep : kAnimatorStateFlagBitsNone;
+  }
+}
+
+void AnimSystem::stepAnimator(Animator& a, usize i) {
+  if (!a.set) return;
+  const auto& state = a.animState;
+  const auto& anim = a.set->anims[state.idx];
+  auto duration = anim.duration;
+
+  if (anim.samples.empty() || duration <= .0f) {
+    if (hot_.frames[i] != 0) {
+      hot_.frames[i] = 0;
+      hot_.flags[i] |= kAnimatorStateFlagBitsDirty;
     }
 
-    auto u0 = a.uTime;
-    auto u1 = std::max(.0f, (globalTime_ - a.startTime) * a.speed);
-    a.uTime = u1;
+    return;
+  }
+
+  auto mode = PTMode::None;
+
+  if (state.pingPong()) {
+    mode = PTMode::PingPong;
+  } else if (state.loop()) {
+    mode = PTMode::Loop;
+  }
+
+  stepAnimatorMode(mode, a, i, anim, hot_.prevUTimes[i], hot_.uTimes[i],
+                   duration);
+}
+
+void AnimSystem::catchUp(Animator& a, usize i) {
+  auto u = std::max(.0f, (globalTime_ - hot_.startTimes[i]) * hot_.speeds[i]);
+  hot_.prevUTimes[i] = u;
+  hot_.uTimes[i] = u;
+  if (!a.set || hot_.finished(i) || hot_.frames[i] == kInvalidAnimFrame) {
+    return;
+  }
+
+  const auto& state = a.animState;
+  const auto& anim = a.set->anims[state.idx];
+  auto duration = anim.duration;
+  if (anim.samples.empty() || duration <= .0f) return;
 
-    auto mode = PTMode::None;
+  auto mode = PTMode::None;
 
-    if (state.pingPong()) {
-      mode = PTMode::PingPong;
-    } else if (state.loop()) {
-      mode = PTMode::Loop;
+  if (state.pingPong()) {
+    mode = PTMode::PingPong;
+  } else if (state.loop()) {
+    mode = PTMode::Loop;
+  }
+
+  // Case: jump straight to the analytic frame. Keys crossed while dormant are
+  // dropped, but a one-shot that ended still reports its end.
+  auto pos = fold(mode, u, u, duration).pos;
+  auto frame = timeIdx(anim, pos);
+  a.progress = pos / duration;
+  hot_.frames[i] = frame;
+  hot_.flags[i] |= kAnimatorStateFlagBitsDirty;
+
+  auto period = state.pingPong() ? duration * 2.0f : duration;
+  if (state.loop() || u < period) return;
+  hot_.flags[i] |= kAnimatorStateFlagBitsFinished;
+  if (hot_.sentEndEvent(i)) return;
+  hot_.flags[i] |= kAnimatorStateFlagBitsSentEndEvent;
+
+  fireAnimEvent(a, animTag(anim.key),
+                {
+                    static_cast<AnimKeyTag>(kBaseAnimKeyTagEnd),
+                    frame,
+                });
+}
+
+void AnimSystem::resolveAnimator(Animator& a, usize i) {
+  hot_.flags[i] &= ~kAnimatorStateFlagBitsDirty;
+  frameChanges_.push_back(a.handle);
+  auto& out = a.frame;
+  out.flipped = hot_.flipped(i);
+  out.tex = a.set ? a.set->tex : kInvalidResourceId;
+
+  if (a.set && a.animState.idx < a.set->anims.size()) {
+    const auto& samples = a.set->anims[a.animState.idx].samples;
+
+    if (!samples.empty()) {
+      auto idx = std::min<usize>(hot_.frames[i], samples.size() - 1);
+      out.sprite = samples[idx].sprite;
     }
+  }
 
-    stepAnimatorMode(mode, a, anim, u0, u1, duration);
+  if (!a.colorMods.empty()) {
+    out.colorMod = gradientMultiply(a.colorMods, a.progress);
+  } else {
+    out.colorMod = kRgbaWhite;
   }
 }
 
 void AnimSystem::fireAnimEvents(Animator& a, const AnimResource& anim,
                                 const PTDiscreteTraversal& tr) {
   auto tag = animTag(anim.key);
+  auto len = static_cast<PTIndex>(anim.keyOffsets.size() - 1);
+  if (len == 0) return;
+
+  auto visit = [&](PTIndex lo, PTIndex hi) {
+    hi = std::min<PTIndex>(hi, len - 1);
+
+    for (auto f = lo; f <= hi; ++f) {
+      fireAnimEvents(a, tag, anim.keysAt(f));
+    }
+  };
 
-  for (const auto& k : anim.keys) {
-    auto u = static_cast<PTIndex>(k.frame);
-    if (tr.contains(u)) fireAnimEvent(a, tag, k);
+  // Case: a key fires at most once per tick, even if the traversal wrapped
+  // around more than once.
+  auto overlap = tr.begin.valid && tr.end.valid &&
+                 tr.begin.lo <= tr.end.hi + PTIndex{1};
+
+  if (tr.fullSweepCount > 0 || overlap) {
+    visit(0, len - 1);
+    return;
   }
+
+  if (tr.begin.valid) visit(tr.begin.lo, tr.begin.hi);
+  if (tr.end.valid) visit(tr.end.lo, tr.end.hi);
 }
 
 void AnimSystem::fireFirstAnimEvents(Animator& a, const AnimResource& anim) {
-  auto tag = animTag(anim.key);
+  fireAnimEvents(a, animTag(anim.key), anim.keysAt(0));
+}
 
-  for (const auto& k : anim.keys) {
-    if (k.frame == 0) {
-      fireAnimEvent(a, tag, k);
-    }
+void AnimSystem::fireAnimEvents(Animator& a, AnimTag tag,
+                                std::span<const AnimKeyFrame> keys) {
+  for (const auto& k : keys) {
+    if (a.listenerCount == 0) return;
+    fireAnimEvent(a, tag, k);
   }
 }
 
 void AnimSystem::fireAnimEvent(Animator& a, AnimTag tag,
                                const AnimKeyFrame& keyFrame) {
-  if (a.listeners.empty()) return;
+  if (a.listenerCount == 0) return;
 
   AnimEvent e{
       .animator = a.handle,
@@ -111,42 +350,60 @@ void AnimSystem::fireAnimEvent(Animator& a, AnimTag tag,
       .key = keyFrame,
   };
 
+  auto idx = a.handle.index;
+  auto keyTag = keyFrame.keyTag;
+  auto anyKeyTag = keyTag != kInvalidAnimKeyTag;
+  fireAnimEvent(a, {idx, tag, keyTag}, e);
+  if (anyKeyTag) fireAnimEvent(a, {idx, tag, kInvalidAnimKeyTag}, e);
+  if (tag == kInvalidAnimTag) return;
+  fireAnimEvent(a, {idx, kInvalidAnimTag, keyTag}, e);
+  if (!anyKeyTag) return;
+  fireAnimEvent(a, {idx, kInvalidAnimTag, kInvalidAnimKeyTag}, e);
+}
+
+void AnimSystem::fireAnimEvent(Animator& a, const AnimEventListenerKey& key,
+                               const AnimEvent& e) {
+  auto it = listeners_.find(key);
+  if (it == listeners_.end()) return;
+
+  // Buckets are never erased, so the reference survives listeners registering
+  // other listeners (rehashing keeps nodes in place).
+  auto& ls = it->second;
+  auto h = a.handle;
   usize i = 0;
 
-  while (i < a.listeners.size()) {
-    const auto& l = a.listeners[i];
-
-    if (!l.fn) {
-      ++i;
-      continue;
-    }
-
-    if ((l.tag != kInvalidAnimTag && l.tag != tag) ||
-        (l.keyTag != kInvalidAnimKeyTag && l.keyTag != keyFrame.keyTag)) {
-      ++i;
-      continue;
-    }
-
-    auto id = l.id;
+  while (i < ls.size()) {
+    auto l = ls[i];
     l.fn(e, l.userData);
-    auto alive = (i < a.listeners.size()) && (a.listeners[i].id == id);
+    if (!hAnimatorPool_.alive(h)) return;
+    auto alive = (i < ls.size()) && (ls[i].id == l.id);
 
     if (!alive) {
       continue;
     }
 
-    // Case: maybe a.listeners got resized (adding a listener inside another
-    // listener), so we need a new alias to make it safe.
-    const auto& postFnL = a.listeners[i];
-
-    if (postFnL.once) {
-      off(a.handle, postFnL.id);
+    if (l.once) {
+      off(h, l.id);
     } else {
       ++i;
     }
   }
 }
 
+void AnimSystem::offAll(Animator& a) {
+  if (a.listenerCount == 0) return;
+  auto idx = a.handle.index;
+
+  std::erase_if(listenerKeys_,
+                [idx](const auto& p) { return p.second.animator == idx; });
+
+  for (auto& [key, ls] : listeners_) {
+    if (key.animator == idx) ls.clear();
+  }
+
+  a.listenerCount = 0;
+}
+
 AnimatorHandle AnimSystem::generate(AnimatorDesc desc) {
   auto* set = RL_ANIMLIB.load(desc.animSet);
   RL_ASSERT(set,
@@ -156,23 +413,30 @@ AnimatorHandle AnimSystem::generate(AnimatorDesc desc) {
 
   auto h = hAnimatorPool_.generate();
   ensureCapacity(animators_, h.index);
+  hot_.resize(animators_.size());
   auto& a = animators_[h.index];
   a.handle = h;
   a.animSet = desc.animSet;
+  a.set = set;
+  hot_.reset(h.index);
+  hot_.flags[h.index] = kAnimatorStateFlagBitsAlive;
   play(a.handle, desc.anim, desc.dir);
 
   if (!desc.colorMods.empty()) {
     colorize(a.handle, std::move(desc.colorMods));
   }
 
+  resolveAnimator(a, h.index);
   return h;
 }
 
 void AnimSystem::destroy(AnimatorHandle h) {
   auto* a = animator(h);
   if (!a) return;
-  RL_ANIMLIB.unload(a->animSet);
+  if (a->set) RL_ANIMLIB.unload(a->animSet);
+  offAll(*a);
   *a = {};
+  hot_.reset(h.index);
   hAnimatorPool_.destroy(h);
 }
 
@@ -222,23 +486,24 @@ void AnimSystem::colorize(AnimatorHandle h, std::vector<Rgba> colorMods) {
   auto* a = animator(h);
   if (!a) return;
   a->colorMods = std::move(colorMods);
+  hot_.flags[h.index] |= kAnimatorStateFlagBitsDirty;
 }
 
 bool AnimSystem::playing(AnimatorHandle h) {
   auto* a = animator(h);
   if (!a) return false;
-  return !a->finished();
+  return !hot_.finished(h.index);
 }
 
 bool AnimSystem::playing(AnimatorHandle h, AnimTag tag) {
   auto* a = animator(h);
   if (!a) return false;
-  return !a->finished() && a->animState.tag == tag;
+  return !hot_.finished(h.index) && a->animState.tag == tag;
 }
 
 bool AnimSystem::flippedX(AnimatorHandle h) const noexcept {
   const auto* a = animator(h);
-  return a && a->flipped();
+  return a && hot_.flipped(h.index);
 }
 
 AnimSetId AnimSystem::animSet(AnimatorHandle h) const noexcept {
@@ -253,58 +518,48 @@ usize AnimSystem::animIdx(AnimatorHandle h) const noexcept {
 
 AnimFrame AnimSystem::animFrame(AnimatorHandle h) const noexcept {
   const auto* a = animator(h);
-  return a ? a->currentFrame : kInvalidAnimFrame;
+  return a ? hot_.frames[h.index] : kInvalidAnimFrame;
 }
 
 bool AnimSystem::resolveFrame(AnimatorHandle h, AnimatorFrame& out) const {
   const auto* a = animator(h);
 
-  if (!a) {
-    out = {};
-    return false;
-  }
-
-  const auto* set = RL_ANIMLIB.get(a->animSet);
-  auto animIdx = a->animState.idx;
-
-  if (!set || animIdx >= set->anims.size()) {
+  if (!a || !a->set || a->animState.idx >= a->set->anims.size() ||
+      a->set->anims[a->animState.idx].samples.empty()) {
     out = {};
     return false;
   }
 
-  const auto& anim = set->anims[animIdx];
-
-  if (anim.samples.empty()) {
-    out = {};
-    return false;
-  }
-
-  auto idx = std::min<usize>(a->currentFrame, anim.samples.size() - 1);
-  const auto& sample = anim.samples[idx];
-
-  out = {
-      .flipped = a->flipped(),
-      .tex = set->tex,
-      .sprite = sample.sprite,
-      .colorMod = a->colorMod,
-  };
-
+  out = a->frame;
   return true;
 }
 
+void AnimSystem::tier(AnimatorHandle h, RelevanceTier tier) {
+  auto* a = animator(h);
+  if (!a) return;
+  auto i = h.index;
+  auto wasDormant = hot_.tiers[i] == RelevanceTier::Dormant;
+  hot_.tiers[i] = tier;
+  if (wasDormant && tier != RelevanceTier::Dormant) catchUp(*a, i);
+}
+
 AnimEventListenerId AnimSystem::on(AnimatorHandle h, AnimEventFn fn,
                                    AnimKeyTag keyTag, AnimTag tag,
                                    void* userData, bool once) noexcept {
   RL_ASSERT(fn, "AnimSystem::on: Function provided is null!");
   auto* a = animator(h);
-  auto id = a->listenerIdCounter++;
-
-  a->listeners.push_back({.once = once,
-                          .id = id,
-                          .tag = tag,
-                          .keyTag = keyTag,
-                          .fn = fn,
-                          .userData = userData});
+  if (!a || !fn) return kInvalidAnimEventListenerId;
+  auto id = listenerIdCounter_++;
+  AnimEventListenerKey key{h.index, tag, keyTag};
+
+  listeners_[key].push_back({.once = once,
+                             .id = id,
+                             .tag = tag,
+                             .keyTag = keyTag,
+                             .fn = fn,
+                             .userData = userData});
+  listenerKeys_.emplace(id, key);
+  ++a->listenerCount;
   return id;
 }
 
@@ -312,12 +567,17 @@ void AnimSystem::off(AnimatorHandle h, AnimEventListenerId id) noexcept {
   RL_ASSERT(id != kInvalidAnimEventListenerId,
             "AnimSystem::off: Listener ID provided is invalid!");
   auto* a = animator(h);
-  auto& l = a->listeners;
+  if (!a) return;
+  auto keyIt = listenerKeys_.find(id);
+  if (keyIt == listenerKeys_.end() || keyIt->second.animator != h.index) return;
+  auto& l = listeners_[keyIt->second];
+  listenerKeys_.erase(keyIt);
 
   for (usize i = 0; i < l.size(); ++i) {
     if (l[i].id == id) {
       l[i] = l.back();
       l.pop_back();
+      --a->listenerCount;
       return;
     }
   }
@@ -325,24 +585,24 @@ void AnimSystem::off(AnimatorHandle h, AnimEventListenerId id) noexcept {
 
 void AnimSystem::once(AnimatorHandle h, AnimEventFn fn, AnimTag tag,
                       AnimKeyTag keyTag, void* userData) noexcept {
-  std::ignore = on(h, fn, tag, keyTag, userData, true);
+  std::ignore = on(h, fn, keyTag, tag, userData, true);
 }
 
-bool AnimSystem::stepFinishedAnimOnce(const Animator& a,
+bool AnimSystem::stepFinishedAnimOnce(const AnimState& state,
                                       const AnimResource& anim, AnimDuration u0,
                                       AnimDuration u1) {
   if (anim.duration <= .0f) return true;
-  if (a.animState.loop()) return false;
+  if (state.loop()) return false;
 
   auto period = anim.duration;
-  if (a.animState.pingPong()) period *= 2.0f;
+  if (state.pingPong()) period *= 2.0f;
   return (u0 < period && u1 >= period);
 }
 
 bool AnimSystem::playInternal(Animator* a, AnimTag tag,
                               const PlaybackDesc& desc) {
   if (!a) return false;
-  const auto* set = RL_ANIMLIB.get(a->animSet);
+  const auto* set = a->set;
   if (!set) return false;
   auto solved = set->solver.solve(animKey(tag, a->dirState.dir));
   usize idx;
@@ -351,17 +611,19 @@ bool AnimSystem::playInternal(Animator* a, AnimTag tag,
             "AnimSystem::playInternal: Invalid index found in animation set!");
   const auto& anim = set->anims[idx];
   auto flags = found ? anim.flags : kAnimFlagBitsNone;
+  auto i = a->handle.index;
+  auto& stateFlags = hot_.flags[i];
 
   if (solved.flipPolicy == AnimFlipPolicy::Flip) {
-    a->stateFlags |= kAnimatorStateFlagBitsFlipped;
+    stateFlags |= kAnimatorStateFlagBitsFlipped;
   } else if (solved.flipPolicy == AnimFlipPolicy::DontFlip) {
-    a->stateFlags &= ~kAnimatorStateFlagBitsFlipped;
+    stateFlags &= ~kAnimatorStateFlagBitsFlipped;
   } else if (solved.flipPolicy == AnimFlipPolicy::Keep) {
     if (a->dirState.bias != CardinalDir::Unset) {
       if (a->dirState.bias != animDir(anim.key)) {
-        a->stateFlags |= kAnimatorStateFlagBitsFlipped;
+        stateFlags |= kAnimatorStateFlagBitsFlipped;
       } else {
-        a->stateFlags &= ~kAnimatorStateFlagBitsFlipped;
+        stateFlags &= ~kAnimatorStateFlagBitsFlipped;
       }
     }
   }
@@ -374,12 +636,13 @@ bool AnimSystem::playInternal(Animator* a, AnimTag tag,
   }
 
   a->animState = {.flags = flags, .tag = tag, .idx = idx};
+  stateFlags |= kAnimatorStateFlagBitsDirty;
 
   if (restart) {
-    a->currentFrame = kInvalidAnimFrame;
-    a->startTime = globalTime_;
-    a->uTime = .0f;
-    a->stateFlags &=
+    hot_.frames[i] = kInvalidAnimFrame;
+    hot_.startTimes[i] = globalTime_;
+    hot_.uTimes[i] = .0f;
+    stateFlags &=
         ~(kAnimatorStateFlagBitsSentEndEvent | kAnimatorStateFlagBitsFinished);
   }
 
@@ -389,18 +652,21 @@ bool AnimSystem::playInternal(Animator* a, AnimTag tag,
 void AnimSystem::speedInternal(Animator* a, AnimSpeed speed,
                                bool preserveProgress) {
   if (!a) return;
+  auto i = a->handle.index;
   speed = avoidNegOrZero(speed);
-  auto oldSpeed = avoidNegOrZero(a->speed);
+  auto oldSpeed = avoidNegOrZero(hot_.speeds[i]);
 
   if (preserveProgress) {
-    auto elapsed = std::max(.0f, (globalTime_ - a->startTime) * oldSpeed);
-    a->startTime = globalTime_ - (elapsed / speed);
+    auto& startTime = hot_.startTimes[i];
+    auto elapsed = std::max(.0f, (globalTime_ - startTime) * oldSpeed);
+    startTime = globalTime_ - (elapsed / speed);
   } else {
-    a->startTime = globalTime_;
-    a->currentFrame = 0;
+    hot_.startTimes[i] = globalTime_;
+    hot_.frames[i] = 0;
+    hot_.flags[i] |= kAnimatorStateFlagBitsDirty;
   }
 
-  a->speed = speed;
+  hot_.speeds[i] = speed;
 }
 
 Animator* AnimSystem::animator(AnimatorHandle h) {
@@ -417,24 +683,30 @@ const Animator* AnimSystem::animator(AnimatorHandle h) const {
   return &animators_[h.index];
 }
 
-void AnimSystem::stepAnimatorMode(PTMode mode, Animator& a,
+void AnimSystem::stepAnimatorMode(PTMode mode, Animator& a, usize i,
                                   const AnimResource& anim, AnimDuration u0,
                                   AnimDuration u1, AnimDuration duration) {
   auto folded = fold(mode, u0, u1, duration);
   auto curPos = folded.pos;
 
-  auto firstStep = a.currentFrame == kInvalidAnimFrame;
-  auto prevFrame = firstStep ? 0 : a.currentFrame;
-  auto curFrame = timeIdx(a, curPos);
+  auto frame = hot_.frames[i];
+  auto firstStep = frame == kInvalidAnimFrame;
+  auto prevFrame = firstStep ? 0 : frame;
+  auto curFrame = timeIdx(anim, curPos);
 
   if (curFrame == kInvalidAnimFrame) {
     curFrame = prevFrame;
   }
 
-  a.currentFrame = curFrame;
-  a.progress = (duration > .0f) ? (curPos / duration) : .0f;
+  // Case: colour and sprite only depend on the frame, so they are resolved
+  // once per frame change rather than once per tick.
+  if (curFrame != frame) {
+    hot_.frames[i] = curFrame;
+    a.progress = (duration > .0f) ? (curPos / duration) : .0f;
+    hot_.flags[i] |= kAnimatorStateFlagBitsDirty;
+  }
 
-  if (!anim.keys.empty() && !anim.samples.empty()) {
+  if (a.listenerCount > 0 && !anim.keys.empty() && !anim.samples.empty()) {
     auto len = static_cast<PTIndex>(std::min<std::size_t>(
         anim.samples.size(), std::numeric_limits<PTIndex>::max()));
 
@@ -448,37 +720,30 @@ void AnimSystem::stepAnimatorMode(PTMode mode, Animator& a,
     }
   }
 
-  if (stepFinishedAnimOnce(a, anim, u0, u1)) {
-    a.stateFlags |= kAnimatorStateFlagBitsFinished;
+  // Case: a listener may have restarted or destroyed the animator.
+  if (!hot_.alive(i) || hot_.frames[i] != curFrame) return;
+  auto& flags = hot_.flags[i];
+
+  if (stepFinishedAnimOnce(a.animState, anim, u0, u1)) {
+    flags |= kAnimatorStateFlagBitsFinished;
   }
 
-  if (a.stateFlags & kAnimatorStateFlagBitsFinished) {
-    if (!a.sentEndEvent()) {
+  if (flags & kAnimatorStateFlagBitsFinished) {
+    if (!hot_.sentEndEvent(i)) {
+      flags |= kAnimatorStateFlagBitsSentEndEvent;
       fireAnimEvent(a, animTag(anim.key),
                     {
                         static_cast<AnimKeyTag>(kBaseAnimKeyTagEnd),
                         curFrame,
                     });
-
-      a.stateFlags |= kAnimatorStateFlagBitsSentEndEvent;
     }
   } else {
-    a.stateFlags &= ~kAnimatorStateFlagBitsSentEndEvent;
-  }
-
-  if (!a.colorMods.empty()) {
-    a.colorMod = gradientMultiply(a.colorMods, a.progress);
-  } else {
-    a.colorMod = kRgbaWhite;
+    flags &= ~kAnimatorStateFlagBitsSentEndEvent;
   }
 }
 
-AnimFrame AnimSystem::timeIdx(const Animator& a, AnimDuration t) {
-  const auto* set = RL_ANIMLIB.get(a.animSet);
-  if (!set) return kInvalidAnimFrame;
-  const auto animIdx = a.animState.idx;
-  if (animIdx >= set->anims.size()) return kInvalidAnimFrame;
-  const auto& accs = set->anims[animIdx].accDurations;
+AnimFrame AnimSystem::timeIdx(const AnimResource& anim, AnimDuration t) {
+  const auto& accs = anim.accDurations;
   if (accs.empty()) return 0;
   auto it = std::upper_bound(accs.begin(), accs.end(), t);
   auto idx = static_cast<AnimFrame>(it - accs.begin());
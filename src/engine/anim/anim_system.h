@@ -24,6 +24,8 @@
 #include "engine/core/handle.h"
 #include "engine/core/param_traversal.h"
 #include "engine/physics/physics.h"
+#include "engine/relevance/relevance_type.h"
+#include "engine/snapshot/snapshot.h"
 
 namespace rl {
 class AnimSystem {
@@ -33,6 +35,9 @@ class AnimSystem {
   void init();
   void shutdown();
 
+  void save(SnapshotWriter& w) const;
+  bool restore(SnapshotReader& r);
+
   void tick(const FramePacket& f);
 
   [[nodiscard]] AnimatorHandle generate(AnimatorDesc desc);
@@ -56,6 +61,13 @@ class AnimSystem {
 
   bool resolveFrame(AnimatorHandle h, AnimatorFrame& out) const;
 
+  void tier(AnimatorHandle h, RelevanceTier tier);
+
+  // Animators whose frame, flip or anim changed during the last tick.
+  std::span<const AnimatorHandle> frameChanges() const noexcept {
+    return frameChanges_;
+  }
+
   [[nodiscard]] AnimEventListenerId on(AnimatorHandle h, AnimEventFn fn,
                                        AnimKeyTag keyTag = kInvalidAnimKeyTag,
                                        AnimTag tag = kInvalidAnimTag,
@@ -74,9 +86,18 @@ class AnimSystem {
   HandlePool<AnimatorTag> hAnimatorPool_{};
 
   std::vector<Animator> animators_{};
+  AnimatorHotState hot_{};
+  std::vector<AnimatorHandle> frameChanges_{};
 
-  static bool stepFinishedAnimOnce(const Animator& a, const AnimResource& anim,
-                                   AnimDuration u0, AnimDuration u1);
+  AnimEventListenerId listenerIdCounter_{0};
+  std::unordered_map<AnimEventListenerKey, std::vector<AnimEventListener>>
+      listeners_{};
+  std::unordered_map<AnimEventListenerId, AnimEventListenerKey>
+      listenerKeys_{};
+
+  static bool stepFinishedAnimOnce(const AnimState& state,
+                                   const AnimResource& anim, AnimDuration u0,
+                                   AnimDuration u1);
 
   AnimSystem() = default;
 
@@ -86,16 +107,25 @@ class AnimSystem {
   Animator* animator(AnimatorHandle h);
   const Animator* animator(AnimatorHandle h) const;
 
-  void stepAnimatorMode(PTMode mode, Animator& a, const AnimResource& anim,
-                        AnimDuration u0, AnimDuration u1,
-                        AnimDuration duration);
+  void advanceTimes(Frame tick);
+  void stepAnimator(Animator& a, usize i);
+  void catchUp(Animator& a, usize i);
+  void stepAnimatorMode(PTMode mode, Animator& a, usize i,
+                        const AnimResource& anim, AnimDuration u0,
+                        AnimDuration u1, AnimDuration duration);
+  void resolveAnimator(Animator& a, usize i);
   void fireAnimEvents(Animator& a, const AnimResource& anim,
                       const PTDiscreteTraversal& tr);
   void fireFirstAnimEvents(Animator& a, const AnimResource& anim);
-
+  void fireAnimEvents(Animator& a, AnimTag tag,
+                      std::span<const AnimKeyFrame> keys);
   void fireAnimEvent(Animator& a, AnimTag tag, const AnimKeyFrame& keyFrame);
+  void fireAnimEvent(Animator& a, const AnimEventListenerKey& key,
+                     const AnimEvent& e);
+  void offAll(Animator& a);
 
-  [[nodiscard]] AnimFrame timeIdx(const Animator& a, AnimDuration t);
+  [[nodiscard]] static AnimFrame timeIdx(const AnimResource& anim,
+                                         AnimDuration t);
 };
 }  // namespace rl
 
@@ -114,6 +114,12 @@ Position CameraSystem::worldCenter(const Camera* c) const {
   return screenToWorld(c, {c->viewport.size.x * .5f, c->viewport.size.y * .5f});
 }
 
+Vec2F32 CameraSystem::worldSize(const Camera* c) const {
+  if (!c) return Vec2F32::zero();
+  auto z = appliedZoom(c);
+  return {c->viewport.size.x / z, c->viewport.size.y / z};
+}
+
 Position CameraSystem::worldToScreen(const Camera* c, const Position& w) const {
   if (!c) return {};
   auto z = appliedZoom(c);
@@ -67,6 +67,15 @@ class CameraSystem {
   Position worldCenter(const Camera* c) const;
   Position worldCenter() const { return worldCenter(main()); }
 
+  Vec2F32 worldSize(const Camera* c) const;
+
+  template <typename Fn>
+  void forEach(Fn&& fn) const {
+    for (const auto& c : cams_) {
+      if (c.handle && hCamPool_.alive(c.handle)) fn(c);
+    }
+  }
+
   Position worldToScreen(CameraHandle h, const Position& w) const {
     return worldToScreen(cam(h), w);
   }
@@ -29,16 +29,19 @@
 #include "engine/core/phase_bus.h"
 #include "engine/event/event_system.h"
 #include "engine/input/action_system.h"
+#include "engine/input/input_replay_system.h"
 #include "engine/input/input_system.h"
 #include "engine/physics/anim_collider_library.h"
 #include "engine/physics/anim_collider_sync_system.h"
 #include "engine/physics/hitbox_system.h"
 #include "engine/physics/physics_system.h"
 #include "engine/player/player_system.h"
+#include "engine/relevance/relevance_system.h"
 #include "engine/render/render_system.h"
 #include "engine/resource/resource_table.h"
 #include "engine/resource/resource_type_registry.h"
 #include "engine/scene/scene_system.h"
+#include "engine/snapshot/snapshot_system.h"
 #include "engine/sound/sound_library.h"
 #include "engine/sound/sound_system.h"
 #include "engine/sprite/atlas_library.h"
@@ -52,23 +55,40 @@ Engine& Engine::instance() {
   return inst;
 }
 
-void Engine::init() {
+void Engine::init(const EngineDesc& desc) {
   RL_LOG_INFO("Engine::init");
+  desc_ = desc;
+  headlessReport_ = {};
+  auto isHeadless = headless();
 
   RL_TIMESYS.init();
   RL_EVENTSYS.init();
-  RL_SOUNDSYS.init();
-  RL_RENDERSYS.init();
+  RL_SOUNDSYS.init(isHeadless ? SoundDeviceKind::Null
+                              : SoundDeviceKind::Miniaudio);
+  RL_RENDERSYS.init(isHeadless ? RenderDeviceKind::Null
+                               : RenderDeviceKind::OpenGl);
   RL_INPUTSYS.init(RL_RENDERSYS.device()->window());
   RL_ACTIONSYS.init();
+  RL_INPUTREPLAY.init();
+  RL_ROLLBACK.init();
+
+  if (!desc.replayPath.empty()) {
+    RL_INPUTREPLAY.replay(desc.replayPath);
+  } else if (!desc.recordPath.empty()) {
+    RL_INPUTREPLAY.record(desc.recordPath, desc.seed);
+  }
+
   RL_TRANSSYS.init();
   RL_PHYSICSSYS.init();
   RL_HITBOXSYS.init();
   RL_ANIMCOLSYNCSYS.init();
   RL_CAMSYS.init();
   RL_ANIMSYS.init();
+  RL_RELEVSYS.init();
   RL_SCENESYS.init();
   RL_PLAYSYS.init();
+  RL_SNAPSHOTSYS.init();
+  registerSnapshots();
 
   RL_RESREG.init();
   RL_RESTAB.init();
@@ -80,6 +100,10 @@ void Engine::init() {
   RL_SOUNDLIB.init();
 
   RL_EVENTSYS.on(kCoreMessageIdQuit, On, this);
+#ifdef RL_DEBUG
+  RL_PHASEBUS.config().validate = true;
+#endif  // RL_DEBUG
+  RL_PHASEBUS.compile();
   RL_PHASEBUS.invoke(LifeCyclePhase::Init);
   shouldExit_ = false;
 }
@@ -87,6 +111,7 @@ void Engine::init() {
 void Engine::shutdown() {
   RL_LOG_INFO("Engine::shutdown");
   RL_PHASEBUS.invoke(LifeCyclePhase::Shutdown);
+  RL_PHASEBUS.shutdown();
 
   RL_SOUNDLIB.shutdown();
   RL_ANIMLIB.shutdown();
@@ -97,14 +122,18 @@ void Engine::shutdown() {
   RL_RESTAB.shutdown();
   RL_RESREG.shutdown();
 
+  RL_SNAPSHOTSYS.shutdown();
   RL_PLAYSYS.shutdown();
   RL_SCENESYS.shutdown();
+  RL_RELEVSYS.shutdown();
   RL_ANIMSYS.shutdown();
   RL_CAMSYS.shutdown();
   RL_ANIMCOLSYNCSYS.shutdown();
   RL_HITBOXSYS.shutdown();
   RL_PHYSICSSYS.shutdown();
   RL_TRANSSYS.shutdown();
+  RL_ROLLBACK.shutdown();
+  RL_INPUTREPLAY.shutdown();
   RL_ACTIONSYS.shutdown();
   RL_INPUTSYS.shutdown();
   RL_RENDERSYS.shutdown();
@@ -114,13 +143,57 @@ void Engine::shutdown() {
   shouldExit_ = true;
 }
 
+void Engine::registerSnapshots() {
+  // Case: registration order is restore order, so handle owners come before
+  // the systems that reference their handles.
+  RL_SNAPSHOTSYS.on(
+      "transform", [](SnapshotWriter& w) { RL_CTRANSSYS.save(w); },
+      [](SnapshotReader& r) { return RL_TRANSSYS.restore(r); });
+  RL_SNAPSHOTSYS.on(
+      "physics", [](SnapshotWriter& w) { RL_CPHYSICSSYS.save(w); },
+      [](SnapshotReader& r) { return RL_PHYSICSSYS.restore(r); });
+  RL_SNAPSHOTSYS.on(
+      "hitbox", [](SnapshotWriter& w) { RL_CHITBOXSYS.save(w); },
+      [](SnapshotReader& r) { return RL_HITBOXSYS.restore(r); });
+  RL_SNAPSHOTSYS.on(
+      "anim", [](SnapshotWriter& w) { RL_CANIMSYS.save(w); },
+      [](SnapshotReader& r) { return RL_ANIMSYS.restore(r); });
+  RL_SNAPSHOTSYS.on(
+      "anim_collider_sync",
+      [](SnapshotWriter& w) { RL_ANIMCOLSYNCSYS.save(w); },
+      [](SnapshotReader& r) { return RL_ANIMCOLSYNCSYS.restore(r); });
+  RL_SNAPSHOTSYS.on(
+      "relevance", [](SnapshotWriter& w) { RL_CRELEVSYS.save(w); },
+      [](SnapshotReader& r) { return RL_RELEVSYS.restore(r); });
+}
+
 void Engine::run() {
   RL_LOG_DEBUG("Engine::run");
   RL_SCENESYS.load();
+  if (desc_.rollback.enabled) RL_ROLLBACK.start(desc_.rollback);
+
+  if (headless()) {
+    runHeadless();
+  } else {
+    runWindowed();
+  }
+
+  if (RL_CROLLBACK.active()) {
+    RL_CROLLBACK.report();
+    RL_ROLLBACK.stop();
+  }
+
+  RL_SCENESYS.unload();
+  RL_EVENTSYS.flush();
+}
+
+void Engine::runWindowed() {
   FramePacket f{};
 
   while (!shouldExit_) {
     RL_TIMESYS.update(f);
+    RL_INPUTREPLAY.frame(f);
+    if (RL_CINPUTREPLAY.finished()) break;
     RL_INPUTSYS.poll();
     RL_PHYSICSSYS.update(f);
 
@@ -129,9 +202,44 @@ void Engine::run() {
     RL_RENDERSYS.update(f);
     ++f.frame;
   }
+}
 
-  RL_SCENESYS.unload();
-  RL_EVENTSYS.flush();
+void Engine::runHeadless() {
+  // Case: no wall clock. Each frame is exactly one fixed step, so the
+  // pipeline ticks once per iteration and as fast as the host allows.
+  FramePacket f{};
+  Frame ticks = 0;
+  auto start = std::chrono::steady_clock::now();
+
+  while (!shouldExit_ && ticks < desc_.headlessTicks) {
+    f.delta = f.step;
+    f.time += f.step;
+    RL_INPUTREPLAY.frame(f);
+    if (RL_CINPUTREPLAY.finished()) break;
+    RL_INPUTSYS.poll();
+    RL_PHYSICSSYS.update(f);
+    f.alpha = f.step > .0 ? f.lag / f.step : .0;
+    ++f.frame;
+    ++ticks;
+  }
+
+  auto seconds = std::chrono::duration<f64>(std::chrono::steady_clock::now() -
+                                            start)
+                     .count();
+
+  headlessReport_ = {
+      .ticks = ticks,
+      .seconds = seconds,
+      .ticksPerSec = seconds > .0 ? static_cast<f64>(ticks) / seconds : .0,
+  };
+
+  RL_LOG_INFO("Engine::runHeadless: Simulated ", headlessReport_.ticks,
+              " ticks in ", headlessReport_.seconds, "s (",
+              headlessReport_.ticksPerSec, " ticks/s).");
+}
+
+u64 Engine::seed() const noexcept {
+  return RL_CINPUTREPLAY.replaying() ? RL_CINPUTREPLAY.seed() : desc_.seed;
 }
 
 #ifdef RL_DEBUG
@@ -17,20 +17,57 @@
 #define ENGINE_CORE_ENGINE_H_
 
 #include "engine/common.h"
+#include "engine/core/frame.h"
 #include "engine/event/message.h"
+#include "engine/net/rollback_system.h"
 
 namespace rl {
+enum class EngineMode : u8 { Windowed, Headless };
+
+struct EngineDesc {
+  EngineMode mode{EngineMode::Windowed};
+  Frame headlessTicks{3600};
+  u64 seed{0};
+  std::filesystem::path recordPath{};
+  std::filesystem::path replayPath{};
+  RollbackDesc rollback{};
+};
+
+struct EngineHeadlessReport {
+  Frame ticks{0};
+  f64 seconds{.0};
+  f64 ticksPerSec{.0};
+};
+
 class Engine {
  public:
   static Engine& instance();
 
-  void init();
+  void init(const EngineDesc& desc = {});
   void shutdown();
 
   void run();
 
+  [[nodiscard]] EngineMode mode() const noexcept { return desc_.mode; }
+  [[nodiscard]] bool headless() const noexcept {
+    return desc_.mode == EngineMode::Headless;
+  }
+
+  // Replays carry the seed they were recorded with.
+  [[nodiscard]] u64 seed() const noexcept;
+
+  [[nodiscard]] const EngineHeadlessReport& headlessReport() const noexcept {
+    return headlessReport_;
+  }
+
  private:
   bool shouldExit_ = true;
+  EngineDesc desc_{};
+  EngineHeadlessReport headlessReport_{};
+
+  void runWindowed();
+  void runHeadless();
+  void registerSnapshots();
 
   Engine() = default;
 
@@ -20,6 +20,7 @@
 
 namespace rl {
 using Frame = u64;
+constexpr auto kInvalidFrame = static_cast<Frame>(-1);
 
 constexpr f64 kFixedHz = 60.0f;
 constexpr f64 kFixedStep = 1.0f / kFixedHz;
@@ -51,6 +52,8 @@ struct FramePacket {
   const f64 step{kFixedStep};
   f64 time{.0};
   f64 alpha{.0};
+  u32 stepCount{0};   // Fixed steps run this frame.
+  f64 dilation{1.0};  // Simulated over elapsed time, below 1 when over budget.
 };
 }  // namespace rl
 
@@ -20,58 +20,205 @@
 #include "engine/core/frame.h"
 
 namespace rl {
-using StateId = u32;
+using StateId = u16;
 constexpr auto kInvalidStateId = static_cast<StateId>(-1);
 
-using StateEventId = u32;
+using StateEventId = u16;
 constexpr auto kInvalidStateEventId = static_cast<StateEventId>(-1);
 
-struct State {
-  virtual ~State() = default;
-  virtual void onEnter() {}
-  virtual void onExit() {}
-  virtual void onUpdate(const FramePacket&) {}
+template <typename Ctx>
+struct FsmState {
+  void (*onEnter)(Ctx&) noexcept {nullptr};
+  void (*onUpdate)(Ctx&, const FramePacket&) noexcept {nullptr};
+  void (*onExit)(Ctx&) noexcept {nullptr};
 };
 
-struct Transition {
+struct FsmTransition {
   StateId from{kInvalidStateId};
   StateId to{kInvalidStateId};
   StateEventId on{kInvalidStateEventId};
 };
 
+template <typename Ctx>
+struct FsmDesc {
+  std::vector<FsmState<Ctx>> states{};
+  std::vector<FsmTransition> transitions{};
+  StateId initial{0};
+};
+
+// Compiled FsmDesc, shared by every Fsm running it: handlers indexed by state
+// and a dense (state x event) -> target table.
+template <typename Ctx>
+class FsmDef {
+ public:
+  using EnterFn = void (*)(Ctx&) noexcept;
+  using UpdateFn = void (*)(Ctx&, const FramePacket&) noexcept;
+  using ExitFn = void (*)(Ctx&) noexcept;
+
+  FsmDef() = default;
+  explicit FsmDef(const FsmDesc<Ctx>& desc) { compile(desc); }
+
+  void compile(const FsmDesc<Ctx>& desc) {
+    stateCount_ = desc.states.size();
+    eventCount_ = 0;
+    initial_ = desc.initial;
+
+    for (const auto& t : desc.transitions) {
+      eventCount_ = std::max(eventCount_, static_cast<usize>(t.on) + 1);
+    }
+
+    onEnter_.resize(stateCount_);
+    onUpdate_.resize(stateCount_);
+    onExit_.resize(stateCount_);
+
+    for (usize s = 0; s < stateCount_; ++s) {
+      onEnter_[s] = desc.states[s].onEnter;
+      onUpdate_[s] = desc.states[s].onUpdate;
+      onExit_[s] = desc.states[s].onExit;
+    }
+
+    targets_.assign(stateCount_ * eventCount_, kInvalidStateId);
+
+    // Case: the first transition declared for a (state, event) pair wins.
+    for (const auto& t : desc.transitions) {
+      RL_ASSERT(t.from < stateCount_ && t.to < stateCount_,
+                "FsmDef::compile: Transition between unknown states!");
+      if (t.from >= stateCount_ || t.to >= stateCount_) continue;
+      auto& target = targets_[t.from * eventCount_ + t.on];
+      if (target == kInvalidStateId) target = t.to;
+    }
+  }
+
+  [[nodiscard]] StateId target(StateId s, StateEventId ev) const noexcept {
+    if (s >= stateCount_ || ev >= eventCount_) return kInvalidStateId;
+    return targets_[s * eventCount_ + ev];
+  }
+
+  [[nodiscard]] StateId initial() const noexcept { return initial_; }
+  [[nodiscard]] usize stateCount() const noexcept { return stateCount_; }
+  [[nodiscard]] EnterFn onEnter(StateId s) const { return onEnter_[s]; }
+  [[nodiscard]] UpdateFn onUpdate(StateId s) const { return onUpdate_[s]; }
+  [[nodiscard]] ExitFn onExit(StateId s) const { return onExit_[s]; }
+
+ private:
+  StateId initial_{0};
+  usize stateCount_{0};
+  usize eventCount_{0};
+  std::vector<EnterFn> onEnter_{};
+  std::vector<UpdateFn> onUpdate_{};
+  std::vector<ExitFn> onExit_{};
+  std::vector<StateId> targets_{};
+};
+
+// Per-object state of a machine. Trivially copyable, so it snapshots as is.
+template <typename Ctx>
 struct Fsm {
+  const FsmDef<Ctx>* def{nullptr};
   StateId current{kInvalidStateId};
-  std::vector<std::unique_ptr<State>> states;
-  std::vector<Transition> transitions{};
 
-  void set(StateId sid) {
+  void start(const FsmDef<Ctx>& d, Ctx& ctx) noexcept {
+    def = &d;
+    current = kInvalidStateId;
+    set(d.initial(), ctx);
+  }
+
+  void set(StateId sid, Ctx& ctx) noexcept {
     if (current == sid) return;
+    transit(sid, ctx);
+  }
 
+  void signal(StateEventId ev, Ctx& ctx) noexcept {
+    auto to = def->target(current, ev);
+    if (to != kInvalidStateId) transit(to, ctx);
+  }
+
+  void tick(Ctx& ctx, const FramePacket& f) noexcept {
+    if (current == kInvalidStateId) return;
+    if (auto fn = def->onUpdate(current)) fn(ctx, f);
+  }
+
+ private:
+  void transit(StateId to, Ctx& ctx) noexcept {
     if (current != kInvalidStateId) {
-      states[current]->onExit();
+      if (auto fn = def->onExit(current)) fn(ctx);
     }
 
-    current = sid;
+    current = to;
 
     if (current != kInvalidStateId) {
-      states[current]->onEnter();
+      if (auto fn = def->onEnter(current)) fn(ctx);
     }
   }
+};
 
-  void update(const FramePacket& f) {
-    if (current != kInvalidStateId) {
-      states[current]->onUpdate(f);
-    }
+// Ticks many machines at once, grouped by definition then by the state they
+// are in when tick is called, so each state's update runs as one loop.
+template <typename Ctx>
+class FsmBatch {
+ public:
+  void clear() {
+    items_.clear();
+    packets_.clear();
+  }
+
+  void add(Fsm<Ctx>& fsm, Ctx& ctx, const FramePacket& f) {
+    if (!fsm.def || fsm.current == kInvalidStateId) return;
+    items_.push_back({&fsm, &ctx, static_cast<u32>(packets_.size())});
+    packets_.push_back(f);
   }
 
-  void signal(StateEventId eid) {
-    for (const auto& t : transitions) {
-      if (t.from == current && t.on == eid) {
-        set(t.to);
-        return;
+  void tick() {
+    // Case: definitions are few, kept in first-seen order.
+    defs_.clear();
+
+    for (const auto& it : items_) {
+      if (std::find(defs_.begin(), defs_.end(), it.fsm->def) == defs_.end()) {
+        defs_.push_back(it.fsm->def);
+      }
+    }
+
+    for (const auto* def : defs_) {
+      auto stateCount = def->stateCount();
+      offsets_.assign(stateCount + 1, 0);
+
+      for (const auto& it : items_) {
+        if (it.fsm->def == def) ++offsets_[it.fsm->current + 1];
+      }
+
+      for (usize s = 0; s < stateCount; ++s) offsets_[s + 1] += offsets_[s];
+      order_.resize(offsets_[stateCount]);
+      cursors_ = offsets_;
+
+      for (u32 i = 0; i < items_.size(); ++i) {
+        const auto& it = items_[i];
+        if (it.fsm->def == def) order_[cursors_[it.fsm->current]++] = i;
+      }
+
+      for (usize s = 0; s < stateCount; ++s) {
+        auto fn = def->onUpdate(static_cast<StateId>(s));
+        if (!fn) continue;
+
+        for (auto k = offsets_[s]; k < offsets_[s + 1]; ++k) {
+          const auto& it = items_[order_[k]];
+          fn(*it.ctx, packets_[it.packet]);
+        }
       }
     }
   }
+
+ private:
+  struct Item {
+    Fsm<Ctx>* fsm{nullptr};
+    Ctx* ctx{nullptr};
+    u32 packet{0};
+  };
+
+  std::vector<Item> items_{};
+  std::vector<FramePacket> packets_{};
+  std::vector<const FsmDef<Ctx>*> defs_{};
+  std::vector<u32> offsets_{};
+  std::vector<u32> cursors_{};
+  std::vector<u32> order_{};
 };
 }  // namespace rl
 
@@ -105,6 +105,19 @@ class HandlePool {
   u32 size() const { return static_cast<u32>(gen_.size()); }
   bool empty() const { return gen_.empty(); }
 
+  // Generations and free list, so handles taken before a save stay valid (or
+  // stale) exactly as they were.
+  template <typename Writer>
+  void save(Writer& w) const {
+    w.write(gen_);
+    w.write(free_);
+  }
+
+  template <typename Reader>
+  bool restore(Reader& r) {
+    return r.read(gen_) && r.read(free_);
+  }
+
  private:
   std::vector<u32> gen_{};
   std::vector<u32> free_{};
@@ -38,21 +38,27 @@ void PhaseBus::init() {
     l.reserve(kCapacity);
   }
 
-  for (auto& t : tick_) {
-    t.clear();
-    t.reserve(kCapacity);
+  for (auto& g : tick_) {
+    g = {};
+    g.tasks.reserve(kCapacity);
   }
+
+  compiled_ = false;
 }
 
 void PhaseBus::shutdown() {
   RL_LOG_DEBUG("PhaseBus::shutdown");
+  workers_.stop();
+
   for (auto& l : lifeCycle_) {
     l.clear();
   }
 
-  for (auto& t : tick_) {
-    t.clear();
+  for (auto& g : tick_) {
+    g = {};
   }
+
+  compiled_ = false;
 }
 
 void PhaseBus::on(LifeCyclePhase phase, LifeCycleFn fn) {
@@ -63,7 +69,43 @@ void PhaseBus::on(LifeCyclePhase phase, LifeCycleFn fn) {
 
 void PhaseBus::on(TickPhase phase, TickFn fn) {
   RL_ASSERT(isTick(phase), "PhaseBus::on: VoidFn is only allowed for ticks");
-  tick_[toUnderlying(phase)].push_back(std::move(fn));
+  auto& g = tick_[toUnderlying(phase)];
+  g.tasks.push_back({.fn = std::move(fn), .exclusive = true});
+  compiled_ = false;
+}
+
+void PhaseBus::on(TickPhase phase, PhaseTaskDesc desc, TickFn fn) {
+  RL_ASSERT(isTick(phase), "PhaseBus::on: VoidFn is only allowed for ticks");
+  auto& g = tick_[toUnderlying(phase)];
+
+  RL_ASSERT(desc.name.empty() ||
+                std::none_of(g.tasks.begin(), g.tasks.end(),
+                             [&](const auto& t) {
+                               return t.desc.name == desc.name;
+                             }),
+            "PhaseBus::on: Duplicate task name: ", desc.name, "!");
+
+  g.tasks.push_back({.desc = std::move(desc), .fn = std::move(fn)});
+  compiled_ = false;
+}
+
+void PhaseBus::compile() {
+  RL_LOG_DEBUG("PhaseBus::compile");
+  auto concurrent = false;
+
+  for (usize i = 0; i < tick_.size(); ++i) {
+    auto& g = tick_[i];
+    compile(static_cast<TickPhase>(i), g);
+    concurrent |= g.concurrent;
+  }
+
+  if (concurrent && workers_.size() != config_.workerCount + 1) {
+    workers_.start(config_.workerCount);
+  } else if (!concurrent) {
+    workers_.stop();
+  }
+
+  compiled_ = true;
 }
 
 void PhaseBus::invoke(LifeCyclePhase phase) {
@@ -76,6 +118,263 @@ void PhaseBus::invoke(TickPhase phase, const FramePacket& f) {
   RL_ASSERT(
       isTick(phase),
       "PhaseBus::invoke: invoke(Phase, FramePacket&) is for tick phases only");
-  for (auto& t : tick_[toUnderlying(phase)]) t(f);
+  if (!compiled_) compile();
+  auto& g = tick_[toUnderlying(phase)];
+
+  if (g.concurrent) {
+    runConcurrent(g, f);
+  } else {
+    runSerial(g, f);
+  }
+
+  updateCriticalPath(g);
+  if (config_.dumpCriticalPath) dumpCriticalPath(phase);
+}
+
+void PhaseBus::dumpCriticalPath(TickPhase phase) const {
+  const auto& g = tick_[toUnderlying(phase)];
+  std::string path{};
+
+  for (auto idx : g.criticalPath) {
+    if (!path.empty()) path += " > ";
+    path += taskName(phase, idx);
+  }
+
+  RL_LOG_INFO("PhaseBus: ",
+              phase == TickPhase::FixedUpdate ? "FixedUpdate" : "Update",
+              " critical path ", g.criticalPathTime * 1000.0, "ms: ", path);
+}
+
+std::span<const PhaseTaskIndex> PhaseBus::criticalPath(
+    TickPhase phase) const noexcept {
+  return tick_[toUnderlying(phase)].criticalPath;
+}
+
+f64 PhaseBus::criticalPathTime(TickPhase phase) const noexcept {
+  return tick_[toUnderlying(phase)].criticalPathTime;
+}
+
+std::string_view PhaseBus::taskName(TickPhase phase,
+                                    PhaseTaskIndex idx) const noexcept {
+  const auto& tasks = tick_[toUnderlying(phase)].tasks;
+  if (idx >= tasks.size()) return {};
+  const auto& name = tasks[idx].desc.name;
+  return name.empty() ? "<unnamed>" : name;
+}
+
+void PhaseBus::compile(TickPhase phase, Graph& g) {
+  auto n = static_cast<PhaseTaskIndex>(g.tasks.size());
+  std::vector<u8> reach(static_cast<usize>(n) * n, 0);
+  auto reaches = [&](PhaseTaskIndex a, PhaseTaskIndex b) -> u8& {
+    return reach[static_cast<usize>(a) * n + b];
+  };
+
+  for (auto& t : g.tasks) {
+    t.next.clear();
+    t.prev.clear();
+  }
+
+  auto link = [&](PhaseTaskIndex a, PhaseTaskIndex b) {
+    if (a == b || reaches(a, b)) return;
+
+    if (reaches(b, a)) {
+      RL_ASSERT(false, "PhaseBus::compile: Cycle between ",
+                taskName(phase, a), " and ", taskName(phase, b), "!");
+      return;
+    }
+
+    g.tasks[a].next.push_back(b);
+    g.tasks[b].prev.push_back(a);
+
+    for (PhaseTaskIndex x = 0; x < n; ++x) {
+      if (x != a && !reaches(x, a)) continue;
+
+      for (PhaseTaskIndex y = 0; y < n; ++y) {
+        if (y == b || reaches(b, y)) reaches(x, y) = 1;
+      }
+    }
+  };
+
+  auto find = [&](std::string_view name) {
+    for (PhaseTaskIndex i = 0; i < n; ++i) {
+      if (g.tasks[i].desc.name == name) return i;
+    }
+
+    RL_ASSERT(false, "PhaseBus::compile: Unknown task: ", name, "!");
+    return n;
+  };
+
+  // Explicit edges first, so they win over registration order.
+  for (PhaseTaskIndex i = 0; i < n; ++i) {
+    const auto& desc = g.tasks[i].desc;
+
+    for (auto name : desc.after) {
+      if (auto j = find(name); j < n) link(j, i);
+    }
+
+    for (auto name : desc.before) {
+      if (auto j = find(name); j < n) link(i, j);
+    }
+  }
+
+  auto shared = [](const auto& a, const auto& b) -> std::string_view {
+    for (auto r : a) {
+      if (std::find(b.begin(), b.end(), r) != b.end()) return r;
+    }
+
+    return {};
+  };
+
+  for (PhaseTaskIndex i = 0; i < n; ++i) {
+    for (PhaseTaskIndex j = i + 1; j < n; ++j) {
+      if (reaches(i, j) || reaches(j, i)) continue;
+      const auto& a = g.tasks[i];
+      const auto& b = g.tasks[j];
+      auto res = shared(a.desc.writes, b.desc.writes);
+      auto writers = !res.empty();
+
+      if (!writers) {
+        res = shared(a.desc.writes, b.desc.reads);
+        if (res.empty()) res = shared(a.desc.reads, b.desc.writes);
+        if (res.empty() && !a.exclusive && !b.exclusive) continue;
+      }
+
+      if (config_.validate && (writers || a.exclusive || b.exclusive)) {
+        RL_LOG_WARN("PhaseBus::compile: ", taskName(phase, i), " and ",
+                    taskName(phase, j), " both write ",
+                    res.empty() ? "<all>" : res,
+                    " and are only ordered by registration.");
+      }
+
+      link(i, j);
+    }
+  }
+
+  // Kahn, lowest index first, so the serial order matches registration
+  // wherever edges allow.
+  g.order.clear();
+  g.pending.assign(n, 0);
+
+  for (PhaseTaskIndex i = 0; i < n; ++i) {
+    g.pending[i] = static_cast<PhaseTaskIndex>(g.tasks[i].prev.size());
+  }
+
+  std::vector<u8> done(n, 0);
+
+  while (g.order.size() < n) {
+    auto next = n;
+
+    for (PhaseTaskIndex i = 0; i < n; ++i) {
+      if (!done[i] && g.pending[i] == 0) {
+        next = i;
+        break;
+      }
+    }
+
+    if (next == n) break;
+    done[next] = 1;
+    g.order.push_back(next);
+    for (auto s : g.tasks[next].next) --g.pending[s];
+  }
+
+  RL_ASSERT(g.order.size() == n, "PhaseBus::compile: Tick graph has a cycle!");
+
+  g.concurrent = false;
+
+  for (PhaseTaskIndex i = 0; i < n && !g.concurrent; ++i) {
+    for (PhaseTaskIndex j = i + 1; j < n; ++j) {
+      if (!reaches(i, j) && !reaches(j, i)) {
+        g.concurrent = config_.workerCount > 0;
+        break;
+      }
+    }
+  }
+}
+
+void PhaseBus::runSerial(Graph& g, const FramePacket& f) {
+  for (auto idx : g.order) runTask(g.tasks[idx], f);
+}
+
+void PhaseBus::runConcurrent(Graph& g, const FramePacket& f) {
+  auto n = static_cast<PhaseTaskIndex>(g.tasks.size());
+  g.ready.clear();
+  g.remaining = n;
+
+  for (PhaseTaskIndex i = 0; i < n; ++i) {
+    g.pending[i] = static_cast<PhaseTaskIndex>(g.tasks[i].prev.size());
+  }
+
+  for (auto i = n; i-- > 0;) {
+    if (g.pending[i] == 0) g.ready.push_back(i);
+  }
+
+  workers_.run([&](usize) {
+    while (true) {
+      PhaseTaskIndex idx;
+
+      {
+        std::unique_lock lock{execMutex_};
+        execCv_.wait(lock,
+                     [&] { return g.remaining == 0 || !g.ready.empty(); });
+        if (g.remaining == 0) return;
+        idx = g.ready.back();
+        g.ready.pop_back();
+      }
+
+      runTask(g.tasks[idx], f);
+
+      {
+        std::scoped_lock lock{execMutex_};
+        --g.remaining;
+
+        for (auto s : g.tasks[idx].next) {
+          if (--g.pending[s] == 0) g.ready.push_back(s);
+        }
+      }
+
+      execCv_.notify_all();
+    }
+  });
+}
+
+void PhaseBus::runTask(Task& t, const FramePacket& f) {
+  if (config_.skipOptional && t.desc.optional) {
+    t.time = .0;
+    return;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  t.fn(f);
+  t.time = std::chrono::duration<f64>(std::chrono::steady_clock::now() - start)
+               .count();
+}
+
+void PhaseBus::updateCriticalPath(Graph& g) {
+  auto n = g.tasks.size();
+  std::vector<f64> finish(n, .0);
+  std::vector<PhaseTaskIndex> from(n, static_cast<PhaseTaskIndex>(n));
+  auto last = static_cast<PhaseTaskIndex>(n);
+
+  for (auto idx : g.order) {
+    auto best = .0;
+
+    for (auto p : g.tasks[idx].prev) {
+      if (finish[p] <= best && from[idx] != n) continue;
+      best = finish[p];
+      from[idx] = p;
+    }
+
+    finish[idx] = best + g.tasks[idx].time;
+    if (last == n || finish[idx] > finish[last]) last = idx;
+  }
+
+  g.criticalPath.clear();
+  g.criticalPathTime = last == n ? .0 : finish[last];
+
+  for (auto idx = last; idx != n; idx = from[idx]) {
+    g.criticalPath.push_back(idx);
+  }
+
+  std::reverse(g.criticalPath.begin(), g.criticalPath.end());
 }
-}  // namespace rl
\ No newline at end of file
+}  // namespace rl
@@ -18,11 +18,37 @@
 
 #include "engine/common.h"
 #include "engine/core/frame.h"
+#include "engine/core/worker_pool.h"
 
 namespace rl {
 enum class LifeCyclePhase { Init, Shutdown };
 enum class TickPhase { FixedUpdate, Update };
 
+// Names are compared by value and must outlive the bus (string literals).
+// Tasks touching the same resource run in registration order unless an
+// explicit before/after edge says otherwise; tasks with no conflict may run
+// concurrently, so they must not dispatch events other than through the
+// EventSystem async API unless they write kPhaseResourceEvents.
+struct PhaseTaskDesc {
+  std::string_view name{};
+  std::vector<std::string_view> reads{};
+  std::vector<std::string_view> writes{};
+  std::vector<std::string_view> after{};
+  std::vector<std::string_view> before{};
+  bool optional{false};  // May be skipped when the frame is over budget.
+};
+
+constexpr std::string_view kPhaseResourceEvents{"events"};
+
+struct PhaseBusConfig {
+  usize workerCount{2};
+  bool validate{false};  // Reports writers ordered by registration only.
+  bool dumpCriticalPath{false};
+  bool skipOptional{false};
+};
+
+using PhaseTaskIndex = u32;
+
 class PhaseBus {
  public:
   using LifeCycleFn = std::function<void()>;
@@ -34,14 +60,58 @@ class PhaseBus {
   void shutdown();
 
   void on(LifeCyclePhase phase, LifeCycleFn fn);
+  // Undeclared tasks are exclusive: they are ordered against every task.
   void on(TickPhase phase, TickFn fn);
+  void on(TickPhase phase, PhaseTaskDesc desc, TickFn fn);
 
+  void compile();
   void invoke(LifeCyclePhase phase);
   void invoke(TickPhase phase, const FramePacket& f);
 
+  void dumpCriticalPath(TickPhase phase) const;
+
+  [[nodiscard]] std::span<const PhaseTaskIndex> criticalPath(
+      TickPhase phase) const noexcept;
+  [[nodiscard]] f64 criticalPathTime(TickPhase phase) const noexcept;
+  [[nodiscard]] std::string_view taskName(TickPhase phase,
+                                          PhaseTaskIndex idx) const noexcept;
+
+  [[nodiscard]] PhaseBusConfig& config() noexcept { return config_; }
+  [[nodiscard]] const PhaseBusConfig& config() const noexcept {
+    return config_;
+  }
+
  private:
+  struct Task {
+    PhaseTaskDesc desc{};
+    TickFn fn{};
+    bool exclusive{false};
+    std::vector<PhaseTaskIndex> next{};
+    std::vector<PhaseTaskIndex> prev{};
+    f64 time{.0};
+  };
+
+  struct Graph {
+    std::vector<Task> tasks{};
+    std::vector<PhaseTaskIndex> order{};  // Topological.
+    std::vector<PhaseTaskIndex> pending{};
+    std::vector<PhaseTaskIndex> ready{};
+    std::vector<PhaseTaskIndex> criticalPath{};
+    f64 criticalPathTime{.0};
+    usize remaining{0};
+    bool concurrent{false};
+  };
+
+  PhaseBusConfig config_{};
   std::array<std::vector<LifeCycleFn>, 2> lifeCycle_{};
-  std::array<std::vector<TickFn>, 2> tick_{};
+  std::array<Graph, 2> tick_{};
+  bool compiled_{false};
+
+  WorkerPool workers_{};
+  std::mutex execMutex_{};
+  std::condition_variable execCv_{};
+
+  PhaseBus() = default;
 
   static bool isLifecycle(LifeCyclePhase p) {
     return p == LifeCyclePhase::Init || p == LifeCyclePhase::Shutdown;
@@ -50,6 +120,12 @@ class PhaseBus {
   static bool isTick(TickPhase p) {
     return p == TickPhase::FixedUpdate || p == TickPhase::Update;
   }
+
+  void compile(TickPhase phase, Graph& g);
+  void runSerial(Graph& g, const FramePacket& f);
+  void runConcurrent(Graph& g, const FramePacket& f);
+  void runTask(Task& t, const FramePacket& f);
+  void updateCriticalPath(Graph& g);
 };
 }  // namespace rl
 
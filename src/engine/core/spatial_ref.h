@@ -44,7 +44,7 @@ struct SpatialRef {
     return type == SpatialRefType::Transform && trans;
   }
 
-  constexpr bool sameTrans(const SpatialRef& other) {
+  constexpr bool sameTrans(const SpatialRef& other) const {
     return type == SpatialRefType::Transform &&
            other.type == SpatialRefType::Transform && trans == other.trans;
   }
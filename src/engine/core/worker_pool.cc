@@ -0,0 +1,104 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "worker_pool.h"
+////////////////////////////////////////////////////////////////////////////////
+
+namespace rl {
+WorkerPool::~WorkerPool() { stop(); }
+
+void WorkerPool::start(usize workerCount) {
+  stop();
+  u64 gen{0};
+
+  {
+    std::scoped_lock lock{mutex_};
+    stopping_ = false;
+    // Case: gen_ carries over from a previous start, and only the runs from
+    // now on are for the new workers.
+    gen = gen_;
+  }
+
+  threads_.reserve(workerCount);
+
+  for (usize i = 0; i < workerCount; ++i) {
+    threads_.emplace_back([this, i, gen] { loop(i + 1, gen); });
+  }
+}
+
+void WorkerPool::stop() {
+  {
+    std::scoped_lock lock{mutex_};
+    stopping_ = true;
+  }
+
+  wake_.notify_all();
+
+  for (auto& t : threads_) {
+    if (t.joinable()) t.join();
+  }
+
+  threads_.clear();
+}
+
+void WorkerPool::run(const WorkerJobFn& job) {
+  if (threads_.empty()) {
+    job(0);
+    return;
+  }
+
+  {
+    std::scoped_lock lock{mutex_};
+    job_ = &job;
+    pending_ = threads_.size();
+    ++gen_;
+  }
+
+  wake_.notify_all();
+  job(0);
+
+  std::unique_lock lock{mutex_};
+  done_.wait(lock, [this] { return pending_ == 0; });
+  job_ = nullptr;
+}
+
+void WorkerPool::loop(usize workerIdx, u64 seen) {
+  while (true) {
+    const WorkerJobFn* job{nullptr};
+
+    {
+      std::unique_lock lock{mutex_};
+      wake_.wait(lock, [&] { return stopping_ || gen_ != seen; });
+      if (stopping_) return;
+      seen = gen_;
+      job = job_;
+    }
+
+    (*job)(workerIdx);
+
+    {
+      std::scoped_lock lock{mutex_};
+      --pending_;
+    }
+
+    done_.notify_one();
+  }
+}
+}  // namespace rl
@@ -0,0 +1,56 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ENGINE_CORE_WORKER_POOL_H_
+#define ENGINE_CORE_WORKER_POOL_H_
+
+#include "engine/common.h"
+
+namespace rl {
+using WorkerJobFn = std::function<void(usize workerIdx)>;
+
+class WorkerPool {
+ public:
+  WorkerPool() = default;
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool(WorkerPool&&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+  WorkerPool& operator=(WorkerPool&&) = delete;
+  ~WorkerPool();
+
+  void start(usize workerCount);
+  void stop();
+
+  // Runs job on every worker and on the calling thread (index 0), then waits
+  // for all of them to return.
+  void run(const WorkerJobFn& job);
+
+  [[nodiscard]] usize size() const noexcept { return threads_.size() + 1; }
+
+ private:
+  std::vector<std::thread> threads_{};
+  std::mutex mutex_{};
+  std::condition_variable wake_{};
+  std::condition_variable done_{};
+  const WorkerJobFn* job_{nullptr};
+  u64 gen_{0};
+  usize pending_{0};
+  bool stopping_{false};
+
+  void loop(usize workerIdx, u64 seen);
+};
+}  // namespace rl
+
+#endif  // ENGINE_CORE_WORKER_POOL_H_
@@ -0,0 +1,142 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ENGINE_EVENT_CHANNEL_H_
+#define ENGINE_EVENT_CHANNEL_H_
+
+#include "engine/common.h"
+
+namespace rl {
+using EventHandlerId = u32;
+constexpr auto kInvalidEventHandlerId = static_cast<EventHandlerId>(-1);
+
+using ChannelId = u32;
+constexpr auto kInvalidChannelId = static_cast<ChannelId>(-1);
+
+template <typename T>
+using ChannelHandlerFn = void (*)(const T&, void* userData);
+
+template <typename T>
+using ChannelBatchHandlerFn = void (*)(std::span<const T>, void* userData);
+
+namespace internal {
+// Case: postAsync() may be a type's first use, on a worker thread.
+inline ChannelId nextChannelId() noexcept {
+  static std::atomic<ChannelId> counter{0};
+  return counter.fetch_add(1, std::memory_order_relaxed);
+}
+}  // namespace internal
+
+// Each event type gets its own channel with a dense id, assigned once on first
+// use, which indexes the channel tables of the event system.
+template <typename T>
+struct Channel {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Channel: Event types must be trivially copyable!");
+
+  static ChannelId id() noexcept {
+    static const ChannelId kId = internal::nextChannelId();
+    return kId;
+  }
+};
+
+namespace internal {
+class ChannelStoreBase {
+ public:
+  virtual ~ChannelStoreBase() = default;
+
+  virtual void deliver() = 0;
+  virtual void clear() = 0;
+  virtual bool off(EventHandlerId id) = 0;
+};
+
+template <typename T>
+class ChannelStore final : public ChannelStoreBase {
+ public:
+  void post(const T& e) { queues_[active_].push_back(e); }
+
+  void postNow(const T& e) {
+    notify(batchHandlers_, std::span<const T>{&e, 1});
+    notify(handlers_, e);
+  }
+
+  void on(EventHandlerId id, ChannelHandlerFn<T> fn, void* userData) {
+    handlers_.push_back({id, fn, userData});
+  }
+
+  void on(EventHandlerId id, ChannelBatchHandlerFn<T> fn, void* userData) {
+    batchHandlers_.push_back({id, fn, userData});
+  }
+
+  void deliver() override {
+    auto& queue = queues_[active_];
+    active_ = static_cast<u8>(!active_);
+
+    if (!queue.empty()) {
+      notify(batchHandlers_, std::span<const T>{queue});
+      for (const auto& e : queue) notify(handlers_, e);
+    }
+
+    queue.clear();
+  }
+
+  void clear() override {
+    for (auto& q : queues_) q.clear();
+    handlers_.clear();
+    batchHandlers_.clear();
+  }
+
+  bool off(EventHandlerId id) override {
+    return eraseHandler(handlers_, id) || eraseHandler(batchHandlers_, id);
+  }
+
+ private:
+  template <typename Fn>
+  struct Handler {
+    EventHandlerId id{kInvalidEventHandlerId};
+    Fn fn{nullptr};
+    void* userData{nullptr};
+  };
+
+  u8 active_{0};
+  std::vector<T> queues_[2]{};
+  std::vector<Handler<ChannelHandlerFn<T>>> handlers_{};
+  std::vector<Handler<ChannelBatchHandlerFn<T>>> batchHandlers_{};
+
+  // Case: a handler may subscribe another one, which only hears the next
+  // events. Unsubscribing is deferred by the event system already.
+  template <typename H, typename E>
+  static void notify(const std::vector<H>& v, const E& e) {
+    for (usize i = 0, count = v.size(); i < count; ++i) {
+      auto h = v[i];
+      h.fn(e, h.userData);
+    }
+  }
+
+  template <typename H>
+  static bool eraseHandler(std::vector<H>& v, EventHandlerId id) {
+    for (usize i = 0; i < v.size(); ++i) {
+      if (v[i].id != id) continue;
+      v.erase(v.begin() + static_cast<std::ptrdiff_t>(i));
+      return true;
+    }
+
+    return false;
+  }
+};
+}  // namespace internal
+}  // namespace rl
+
+#endif  // ENGINE_EVENT_CHANNEL_H_
@@ -29,7 +29,21 @@ EventSystem& EventSystem::instance() {
   return inst;
 }
 
-void EventSystem::init() { RL_LOG_DEBUG("EventSystem::init"); }
+namespace internal {
+struct EventThreadState {
+  void* queue{nullptr};
+  u32 gen{static_cast<u32>(-1)};
+  EventProducerId producer{kInvalidEventProducerId};
+};
+
+thread_local EventThreadState tEventThread{};
+}  // namespace internal
+
+void EventSystem::init() {
+  RL_LOG_DEBUG("EventSystem::init");
+  tickCount_.store(0, std::memory_order_relaxed);
+  asyncGen_.fetch_add(1, std::memory_order_acq_rel);
+}
 
 void EventSystem::shutdown() {
   RL_LOG_DEBUG("EventSystem::shutdown");
@@ -39,9 +53,22 @@ void EventSystem::shutdown() {
   }
 
   handlers_.clear();
+  handler_to_mid_.clear();
+  channels_.clear();
+  handler_to_channel_.clear();
+  off_pending_.clear();
+
+  std::scoped_lock lock{asyncMutex_};
+  asyncGen_.fetch_add(1, std::memory_order_acq_rel);
+  asyncQueues_.clear();
+  asyncMerge_.clear();
+  nextAutoProducer_ = 0;
 }
 
 void EventSystem::tick() {
+  mergeAsync();
+  tickCount_.fetch_add(1, std::memory_order_relaxed);
+
   auto& queue{queues_[active_queues_]};
   active_queues_ = static_cast<u8>(!active_queues_);
 
@@ -51,6 +78,12 @@ void EventSystem::tick() {
 
   queue.clear();
 
+  // Case: a handler may post or subscribe to a new event type, which grows
+  // channels_. Those only deliver on the next tick.
+  for (usize i = 0, count = channels_.size(); i < count; ++i) {
+    if (channels_[i]) channels_[i]->deliver();
+  }
+
   for (auto hid : off_pending_) {
     offInternal(hid);
   }
@@ -75,17 +108,140 @@ EventHandlerId EventSystem::on(MessageId mid, EventHandlerFn fn,
 
 void EventSystem::off(EventHandlerId id) { off_pending_.push_back(id); }
 
+void EventSystem::bindProducer(EventProducerId id) {
+  RL_ASSERT(id < kAutoProducerBase,
+            "EventSystem::bindProducer: Producer id is reserved: ", id, "!");
+  internal::tEventThread.producer = id;
+  auto& q = asyncQueue();
+  std::scoped_lock lock{asyncMutex_};
+  q.producer = id;
+}
+
+EventSystem::AsyncQueue& EventSystem::asyncQueue() {
+  auto& t = internal::tEventThread;
+  auto gen = asyncGen_.load(std::memory_order_acquire);
+
+  if (t.queue && t.gen == gen) {
+    return *static_cast<AsyncQueue*>(t.queue);
+  }
+
+  // Case: first post from this thread (or since the last init), which is the
+  // only time a producer takes the lock.
+  std::scoped_lock lock{asyncMutex_};
+  auto& q = asyncQueues_.emplace_back(std::make_unique<AsyncQueue>());
+  q->producer = t.producer != kInvalidEventProducerId
+                    ? t.producer
+                    : kAutoProducerBase + nextAutoProducer_++;
+  t.queue = q.get();
+  t.gen = gen;
+  return *q;
+}
+
+void EventSystem::postBytes(ErasedPostFn post, const void* data, usize size) {
+  auto& q = asyncQueue();
+  auto tick = tickCount_.load(std::memory_order_relaxed);
+
+  if (tick != q.lastTick) {
+    q.lastTick = tick;
+    q.seq = 0;
+  }
+
+  q.writing.store(true, std::memory_order_seq_cst);
+  auto& buffer = q.buffers[q.active.load(std::memory_order_seq_cst)];
+  auto offset = buffer.bytes.size();
+  buffer.bytes.resize(offset + size);
+  std::memcpy(buffer.bytes.data() + offset, data, size);
+
+  buffer.entries.push_back({
+      .tick = tick,
+      .seq = q.seq++,
+      .offset = static_cast<u32>(offset),
+      .size = static_cast<u32>(size),
+      .post = post,
+  });
+
+  q.writing.store(false, std::memory_order_release);
+}
+
+void EventSystem::mergeAsync() {
+  std::scoped_lock lock{asyncMutex_};
+  if (asyncQueues_.empty()) return;
+  asyncMerge_.clear();
+
+  for (auto& q : asyncQueues_) {
+    auto old = q->active.load(std::memory_order_relaxed);
+    q->active.store(static_cast<u8>(!old), std::memory_order_seq_cst);
+
+    // Case: store then load on two flags, mirrored by the producer. Both must
+    // be seq_cst, or each side may miss the other's store.
+    while (q->writing.load(std::memory_order_seq_cst)) {
+      std::this_thread::yield();
+    }
+
+    const auto& buffer = q->buffers[old];
+
+    for (const auto& e : buffer.entries) {
+      asyncMerge_.push_back({&e, &buffer, q->producer});
+    }
+  }
+
+  std::sort(asyncMerge_.begin(), asyncMerge_.end(),
+            [](const auto& a, const auto& b) {
+              if (a.entry->tick != b.entry->tick) {
+                return a.entry->tick < b.entry->tick;
+              }
+
+              if (a.entry->seq != b.entry->seq) {
+                return a.entry->seq < b.entry->seq;
+              }
+
+              return a.producer < b.producer;
+            });
+
+  for (const auto& m : asyncMerge_) {
+    const auto* data = m.buffer->bytes.data() + m.entry->offset;
+
+    if (m.entry->post) {
+      m.entry->post(data);
+      continue;
+    }
+
+    Message msg{kInvalidMessageId};
+    std::memcpy(static_cast<void*>(&msg), data, sizeof(Message));
+    dispatch(msg);
+  }
+
+  asyncMerge_.clear();
+
+  for (auto& q : asyncQueues_) {
+    auto old = static_cast<u8>(!q->active.load(std::memory_order_relaxed));
+    q->buffers[old].clear();
+  }
+}
+
 void EventSystem::deliver(const Message& m) {
   auto it = handlers_.find(m.id);
   if (it == handlers_.cend()) return;
   auto& handlers = it->second;
 
-  for (auto& h : handlers) {
+  // Case: a handler may subscribe another one, which grows the vector.
+  for (usize i = 0, count = handlers.size(); i < count; ++i) {
+    auto h = handlers[i];
     h.fn(m, h.userData);
   }
 }
 
 void EventSystem::offInternal(EventHandlerId id) {
+  if (auto cit = handler_to_channel_.find(id);
+      cit != handler_to_channel_.cend()) {
+    if (cit->second < channels_.size() && channels_[cit->second]) {
+      channels_[cit->second]->off(id);
+    }
+
+    handler_to_channel_.erase(cit);
+    return;
+  }
+
   auto it = handler_to_mid_.find(id);
   if (it == handler_to_mid_.cend()) return;
 
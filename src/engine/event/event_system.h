@@ -17,13 +17,16 @@
 #define ENGINE_EVENT_EVENT_SYSTEM_H_
 
 #include "engine/common.h"
+#include "engine/core/frame.h"
+#include "engine/event/channel.h"
 #include "engine/event/message.h"
 
 namespace rl {
-using EventHandlerId = u32;
-constexpr auto kInvalidEventHandlerId = static_cast<EventHandlerId>(-1);
 using EventHandlerFn = void (*)(const Message&, void* userData);
 
+using EventProducerId = u32;
+constexpr auto kInvalidEventProducerId = static_cast<EventProducerId>(-1);
+
 class EventSystem {
  public:
   static EventSystem& instance();
@@ -50,6 +53,50 @@ class EventSystem {
   EventHandlerId on(MessageId mid, EventHandlerFn fn, void* userData = nullptr);
   void off(EventHandlerId id);
 
+  // Typed channels. Queued events are delivered on tick, after messages, in
+  // channel id order. Batch handlers get the whole queue of a channel at once.
+  template <typename T>
+  void post(const T& e) {
+    channel<T>().post(e);
+  }
+
+  template <typename T>
+  void postNow(const T& e) {
+    channel<T>().postNow(e);
+  }
+
+  // Thread-safe posting. Each thread appends to its own buffer without locks;
+  // buffers are merged on tick, after the events posted with dispatch/post,
+  // ordered by (tick, per-thread sequence, producer id). Workers should bind a
+  // stable producer id first to keep the merge order deterministic: threads
+  // that do not get ids in the order they first post, which may vary.
+  void bindProducer(EventProducerId id);
+
+  void dispatchAsync(const Message& m) {
+    postBytes(nullptr, &m, sizeof(Message));
+  }
+
+  template <typename... Ps>
+  void dispatchAsync(MessageId mid, Ps&&... ps) {
+    dispatchAsync(Message{mid, ps...});
+  }
+
+  template <typename T>
+  void postAsync(const T& e) {
+    std::ignore = Channel<T>::id();
+    postBytes(&EventSystem::postErased<T>, &e, sizeof(T));
+  }
+
+  template <typename T>
+  EventHandlerId on(ChannelHandlerFn<T> fn, void* userData = nullptr) {
+    return onChannel<T>(fn, userData);
+  }
+
+  template <typename T>
+  EventHandlerId on(ChannelBatchHandlerFn<T> fn, void* userData = nullptr) {
+    return onChannel<T>(fn, userData);
+  }
+
  private:
   struct Handler {
     EventHandlerId id{kInvalidEventHandlerId};
@@ -65,8 +112,86 @@ class EventSystem {
   std::vector<EventHandlerId> off_pending_{};
   EventHandlerId event_handler_id_counter_{0};
 
+  std::vector<std::unique_ptr<internal::ChannelStoreBase>> channels_{};
+  std::unordered_map<EventHandlerId, ChannelId> handler_to_channel_{};
+
+  using ErasedPostFn = void (*)(const std::byte*);
+
+  struct AsyncEntry {
+    Frame tick{0};
+    u32 seq{0};
+    u32 offset{0};
+    u32 size{0};
+    ErasedPostFn post{nullptr};  // Null for messages.
+  };
+
+  struct AsyncBuffer {
+    std::vector<AsyncEntry> entries{};
+    std::vector<std::byte> bytes{};
+
+    void clear() {
+      entries.clear();
+      bytes.clear();
+    }
+  };
+
+  // Single producer, single consumer. The producer flags itself as writing
+  // before reading the active buffer, so the consumer only ever waits for one
+  // in-flight append after swapping.
+  struct AsyncQueue {
+    EventProducerId producer{kInvalidEventProducerId};
+    Frame lastTick{0};
+    u32 seq{0};
+    std::atomic<u8> active{0};
+    std::atomic<bool> writing{false};
+    AsyncBuffer buffers[2]{};
+  };
+
+  struct AsyncMergeEntry {
+    const AsyncEntry* entry{nullptr};
+    const AsyncBuffer* buffer{nullptr};
+    EventProducerId producer{kInvalidEventProducerId};
+  };
+
+  std::atomic<Frame> tickCount_{0};
+  std::atomic<u32> asyncGen_{0};
+  std::mutex asyncMutex_{};
+  EventProducerId nextAutoProducer_{0};
+  std::vector<std::unique_ptr<AsyncQueue>> asyncQueues_{};
+  std::vector<AsyncMergeEntry> asyncMerge_{};
+
+  static constexpr EventProducerId kAutoProducerBase = 1u << 16;
+
   EventSystem() = default;
 
+  template <typename T>
+  static void postErased(const std::byte* data) {
+    T e;
+    std::memcpy(&e, data, sizeof(T));
+    instance().post(e);
+  }
+
+  AsyncQueue& asyncQueue();
+  void postBytes(ErasedPostFn post, const void* data, usize size);
+  void mergeAsync();
+
+  template <typename T>
+  internal::ChannelStore<T>& channel() {
+    auto id = Channel<T>::id();
+    if (id >= channels_.size()) channels_.resize(id + 1);
+    auto& c = channels_[id];
+    if (!c) c = std::make_unique<internal::ChannelStore<T>>();
+    return static_cast<internal::ChannelStore<T>&>(*c);
+  }
+
+  template <typename T, typename Fn>
+  EventHandlerId onChannel(Fn fn, void* userData) {
+    const EventHandlerId hid = event_handler_id_counter_++;
+    channel<T>().on(hid, fn, userData);
+    handler_to_channel_[hid] = Channel<T>::id();
+    return hid;
+  }
+
   void deliver(const Message& m);
   void offInternal(EventHandlerId id);
 };
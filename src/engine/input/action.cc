@@ -36,4 +36,23 @@ InputControllerId fromScopeToController(ActionScope scope) {
   if (!player) return kInvalidInputControllerId;
   return RL_PLAYSYS.gamepad(player);
 }
+
+bool sameActionFrame(const ActionFrame& a, const ActionFrame& b) {
+  if (a.digital != b.digital) return false;
+  if (a.analog.size() != b.analog.size()) return false;
+  if (a.axes.size() != b.axes.size()) return false;
+
+  for (usize i = 0; i < a.analog.size(); ++i) {
+    if (a.analog[i].key != b.analog[i].key) return false;
+    if (a.analog[i].value != b.analog[i].value) return false;
+  }
+
+  for (usize i = 0; i < a.axes.size(); ++i) {
+    if (a.axes[i].key != b.axes[i].key) return false;
+    if (a.axes[i].value.x != b.axes[i].value.x) return false;
+    if (a.axes[i].value.y != b.axes[i].value.y) return false;
+  }
+
+  return true;
+}
 }  // namespace rl
\ No newline at end of file
@@ -18,6 +18,7 @@
 
 #include "engine/common.h"
 #include "engine/input/input.h"
+#include "engine/math/vec2.h"
 #include "engine/player/player.h"
 
 namespace rl {
@@ -307,8 +308,33 @@ struct ActionSet {
   ActionBindings bindings{};
 };
 
+struct ActionAnalogValue {
+  ActionKey key{kInvalidActionKey};
+  f32 value{.0f};
+};
+
+struct ActionAxisValue {
+  ActionKey key{kInvalidActionKey};
+  Vec2F32 value{};
+};
+
+// Resolved action state for one fixed tick. Only active actions are kept,
+// each list sorted by key.
+struct ActionFrame {
+  std::vector<ActionKey> digital{};
+  std::vector<ActionAnalogValue> analog{};
+  std::vector<ActionAxisValue> axes{};
+
+  void clear() {
+    digital.clear();
+    analog.clear();
+    axes.clear();
+  }
+};
+
 PlayerHandle fromScopeToPlayer(ActionScope scope);
 InputControllerId fromScopeToController(ActionScope scope);
+bool sameActionFrame(const ActionFrame& a, const ActionFrame& b);
 }  // namespace rl
 
 #endif  // ENGINE_INPUT_ACTION_H_
@@ -81,6 +81,82 @@ void ActionSystem::enable(ActionScope s, bool active) {
 
 void ActionSystem::disable(ActionScope s) { enable(s, false); }
 
+void ActionSystem::capture(ActionFrame& out) const {
+  out.clear();
+  auto enabled = [this](ActionKey key) {
+    return scopeStates_.test(static_cast<usize>(actionScopeFromKey(key)));
+  };
+
+  for (const auto& [key, bindings] : digitalBtnBindings_) {
+    if (!enabled(key)) continue;
+    auto scope = actionScopeFromKey(key);
+
+    for (const auto& b : bindings) {
+      if (!digitalBtnValue(scope, b)) continue;
+      out.digital.push_back(key);
+      break;
+    }
+  }
+
+  for (const auto& [key, bindings] : analogBtnBindings_) {
+    if (!enabled(key)) continue;
+    auto scope = actionScopeFromKey(key);
+    f32 best = .0f;
+
+    for (const auto& b : bindings) {
+      auto v = analogBtnValue(b, scope);
+      if (std::fabs(v) > std::fabs(best)) best = v;
+    }
+
+    if (best != .0f) out.analog.push_back({key, std::clamp(best, -1.0f, 1.0f)});
+  }
+
+  for (const auto& [key, bindings] : analogAxisBindings_) {
+    if (!enabled(key)) continue;
+    auto scope = actionScopeFromKey(key);
+    auto best = Vec2F32::zero();
+    f32 bestM = .0f;
+
+    for (const auto& b : bindings) {
+      auto v = analogAxisValue(b, scope);
+      auto m = v.magSqrd();
+
+      if (m > bestM) {
+        best = v;
+        bestM = m;
+      }
+    }
+
+    if (bestM > .0f) out.axes.push_back({key, best});
+  }
+
+  auto byKey = [](const auto& a, const auto& b) { return a.key < b.key; };
+  std::sort(out.digital.begin(), out.digital.end());
+  std::sort(out.analog.begin(), out.analog.end(), byKey);
+  std::sort(out.axes.begin(), out.axes.end(), byKey);
+}
+
+bool ActionSystem::latchedOn(ActionKey key) const {
+  const auto& d = latched_->digital;
+  return std::binary_search(d.begin(), d.end(), key);
+}
+
+f32 ActionSystem::latchedAnalog(ActionKey key) const {
+  const auto& a = latched_->analog;
+  auto it = std::lower_bound(
+      a.begin(), a.end(), key,
+      [](const auto& v, ActionKey k) { return v.key < k; });
+  return it != a.end() && it->key == key ? it->value : .0f;
+}
+
+Vec2F32 ActionSystem::latchedAxis(ActionKey key) const {
+  const auto& a = latched_->axes;
+  auto it = std::lower_bound(
+      a.begin(), a.end(), key,
+      [](const auto& v, ActionKey k) { return v.key < k; });
+  return it != a.end() && it->key == key ? it->value : Vec2F32::zero();
+}
+
 bool ActionSystem::digitalBtnValue(
     ActionScope scope, const ActionDigitalBtnBinding& binding) const {
   switch (binding.device) {
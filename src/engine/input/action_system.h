@@ -36,11 +36,20 @@ class ActionSystem {
   void enable(ActionScope s, bool active = true);
   void disable(ActionScope s);
 
+  // Resolves every bound action of the enabled scopes against live input.
+  void capture(ActionFrame& out) const;
+
+  // While a frame is latched, queries read it instead of live input. Used to
+  // record and replay the exact state seen by each fixed tick.
+  void latch(const ActionFrame* frame) noexcept { latched_ = frame; }
+  [[nodiscard]] const ActionFrame* latched() const noexcept { return latched_; }
+
   template <class Enum>
   bool on(ActionScope scope, Enum action) const {
     auto idx = static_cast<usize>(scope);
     if (!scopeStates_.test(idx)) return false;
     auto key = actionKey(scope, static_cast<ActionTag>(action));
+    if (latched_) return latchedOn(key);
     auto it = digitalBtnBindings_.find(key);
     if (it == digitalBtnBindings_.cend()) return false;
     const auto& bindings = it->second;
@@ -57,6 +66,7 @@ class ActionSystem {
     auto idx = static_cast<usize>(scope);
     if (!scopeStates_.test(idx)) return .0f;
     auto key = actionKey(scope, static_cast<ActionTag>(action));
+    if (latched_) return latchedAnalog(key);
     auto it = analogBtnBindings_.find(key);
     if (it == analogBtnBindings_.cend()) return .0f;
     const auto& bindings = it->second;
@@ -75,6 +85,7 @@ class ActionSystem {
     auto idx = static_cast<usize>(scope);
     if (!scopeStates_.test(idx)) return Vec2F32::zero();
     auto key = actionKey(scope, static_cast<ActionTag>(action));
+    if (latched_) return latchedAxis(key);
     auto it = analogAxisBindings_.find(key);
     if (it == analogAxisBindings_.cend()) return Vec2F32::zero();
 
@@ -102,6 +113,7 @@ class ActionSystem {
       analogBtnBindings_{};
   std::unordered_map<ActionKey, std::vector<ActionAnalogAxisBinding>>
       analogAxisBindings_{};
+  const ActionFrame* latched_{nullptr};
 
   ActionSystem() = default;
 
@@ -135,6 +147,10 @@ class ActionSystem {
     }
   }
 
+  bool latchedOn(ActionKey key) const;
+  f32 latchedAnalog(ActionKey key) const;
+  Vec2F32 latchedAxis(ActionKey key) const;
+
   bool digitalBtnValue(ActionScope scope,
                        const ActionDigitalBtnBinding& binding) const;
 
@@ -0,0 +1,234 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "input_replay_system.h"
+////////////////////////////////////////////////////////////////////////////////
+
+#include "engine/core/serialize.h"
+#include "engine/input/action_system.h"
+#include "engine/input/input_system.h"
+
+namespace rl {
+InputReplaySystem& InputReplaySystem::instance() {
+  static InputReplaySystem inst;
+  return inst;
+}
+
+void InputReplaySystem::init() {
+  RL_LOG_DEBUG("InputReplaySystem::init");
+  stop();
+}
+
+void InputReplaySystem::shutdown() {
+  RL_LOG_DEBUG("InputReplaySystem::shutdown");
+  stop();
+}
+
+bool InputReplaySystem::record(const std::filesystem::path& path, u64 seed) {
+  stop();
+  os_.open(path, std::ios::binary | std::ios::trunc);
+
+  if (!os_) {
+    RL_LOG_ERR("InputReplaySystem::record: Could not open file: ", path, "!");
+    return false;
+  }
+
+  writePod(os_, kMagic);
+  writePod(os_, kVersion);
+  writePod(os_, seed);
+
+  mode_ = InputReplayMode::Record;
+  seed_ = seed;
+  RL_LOG_INFO("InputReplaySystem::record: Recording to ", path, ".");
+  return true;
+}
+
+bool InputReplaySystem::replay(const std::filesystem::path& path) {
+  stop();
+  is_.open(path, std::ios::binary);
+
+  if (!is_) {
+    RL_LOG_ERR("InputReplaySystem::replay: Could not open file: ", path, "!");
+    return false;
+  }
+
+  u32 magic{0};
+  u16 version{0};
+  readPod(is_, magic);
+  readPod(is_, version);
+  readPod(is_, seed_);
+
+  if (!is_ || magic != kMagic || version != kVersion) {
+    RL_LOG_ERR("InputReplaySystem::replay: Invalid replay file: ", path, "!");
+    is_.close();
+    seed_ = 0;
+    return false;
+  }
+
+  mode_ = InputReplayMode::Replay;
+  RL_LOG_INFO("InputReplaySystem::replay: Replaying ", path,
+              " (seed: ", seed_, ").");
+  return true;
+}
+
+void InputReplaySystem::stop() {
+  if (os_.is_open()) {
+    writePod(os_, Record::End);
+    os_.close();
+  }
+
+  if (is_.is_open()) is_.close();
+  if (mode_ != InputReplayMode::Off) RL_ACTIONSYS.latch(nullptr);
+
+  mode_ = InputReplayMode::Off;
+  finished_ = false;
+  seed_ = 0;
+  tickCount_ = 0;
+  time_ = .0;
+  frame_.clear();
+  prevFrame_.clear();
+  scroll_ = InputMouseScroll::zero();
+  prevScroll_ = InputMouseScroll::zero();
+}
+
+void InputReplaySystem::frame(FramePacket& f) {
+  if (mode_ == InputReplayMode::Record) {
+    writePod(os_, Record::Frame);
+    writePod(os_, f.delta);
+    return;
+  }
+
+  if (mode_ != InputReplayMode::Replay || finished_) return;
+  auto tag = Record::End;
+  readPod(is_, tag);
+
+  if (!is_ || tag != Record::Frame) {
+    finish(tag == Record::End ? "end of stream" : "frame desync");
+    return;
+  }
+
+  f64 delta{.0};
+  readPod(is_, delta);
+  time_ += delta;
+  f.delta = delta;
+  f.time = time_;
+}
+
+void InputReplaySystem::tick() {
+  switch (mode_) {
+    case InputReplayMode::Record:
+      RL_CACTIONSYS.capture(frame_);
+      scroll_ = RL_CINPUTSYS.scrollDelta();
+      writeTick();
+      RL_ACTIONSYS.latch(&frame_);
+      ++tickCount_;
+      break;
+    case InputReplayMode::Replay:
+      if (finished_) break;
+
+      if (!readTick()) {
+        finish("tick desync");
+        break;
+      }
+
+      RL_ACTIONSYS.latch(&frame_);
+      RL_INPUTSYS.scrollDelta(scroll_);
+      ++tickCount_;
+      break;
+    case InputReplayMode::Off:
+    default:
+      break;
+  }
+}
+
+void InputReplaySystem::writeTick() {
+  // Case: held input is the common case, so unchanged ticks cost one byte.
+  if (tickCount_ > 0 && sameActionFrame(frame_, prevFrame_) &&
+      scroll_.x == prevScroll_.x && scroll_.y == prevScroll_.y) {
+    writePod(os_, Record::Repeat);
+    return;
+  }
+
+  writePod(os_, Record::Tick);
+  writePod(os_, static_cast<u16>(frame_.digital.size()));
+  writePod(os_, static_cast<u16>(frame_.analog.size()));
+  writePod(os_, static_cast<u16>(frame_.axes.size()));
+  for (auto k : frame_.digital) writePod(os_, k);
+
+  for (const auto& a : frame_.analog) {
+    writePod(os_, a.key);
+    writePod(os_, a.value);
+  }
+
+  for (const auto& a : frame_.axes) {
+    writePod(os_, a.key);
+    writePod(os_, a.value.x);
+    writePod(os_, a.value.y);
+  }
+
+  writePod(os_, scroll_.x);
+  writePod(os_, scroll_.y);
+
+  prevFrame_ = frame_;
+  prevScroll_ = scroll_;
+}
+
+bool InputReplaySystem::readTick() {
+  auto tag = Record::End;
+  readPod(is_, tag);
+  if (!is_) return false;
+  if (tag == Record::Repeat) return tickCount_ > 0;
+  if (tag != Record::Tick) return false;
+
+  u16 digitalCount{0};
+  u16 analogCount{0};
+  u16 axisCount{0};
+  readPod(is_, digitalCount);
+  readPod(is_, analogCount);
+  readPod(is_, axisCount);
+
+  frame_.digital.resize(digitalCount);
+  frame_.analog.resize(analogCount);
+  frame_.axes.resize(axisCount);
+  for (auto& k : frame_.digital) readPod(is_, k);
+
+  for (auto& a : frame_.analog) {
+    readPod(is_, a.key);
+    readPod(is_, a.value);
+  }
+
+  for (auto& a : frame_.axes) {
+    readPod(is_, a.key);
+    readPod(is_, a.value.x);
+    readPod(is_, a.value.y);
+  }
+
+  readPod(is_, scroll_.x);
+  readPod(is_, scroll_.y);
+  return static_cast<bool>(is_);
+}
+
+void InputReplaySystem::finish(std::string_view reason) {
+  finished_ = true;
+  RL_ACTIONSYS.latch(nullptr);
+  RL_LOG_INFO("InputReplaySystem: Replay finished after ", tickCount_,
+              " ticks (", reason, ").");
+}
+}  // namespace rl
@@ -0,0 +1,88 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ENGINE_INPUT_INPUT_REPLAY_SYSTEM_H_
+#define ENGINE_INPUT_INPUT_REPLAY_SYSTEM_H_
+
+#include "engine/common.h"
+#include "engine/core/frame.h"
+#include "engine/input/action.h"
+#include "engine/input/input.h"
+
+namespace rl {
+enum class InputReplayMode : u8 { Off, Record, Replay };
+
+// Records what the simulation consumed (frame deltas, per fixed tick action
+// state, scroll) with the session seed, and feeds it back in place of live
+// input and wall-clock time.
+class InputReplaySystem {
+ public:
+  static InputReplaySystem& instance();
+
+  void init();
+  void shutdown();
+
+  bool record(const std::filesystem::path& path, u64 seed);
+  bool replay(const std::filesystem::path& path);
+  void stop();
+
+  // Once per frame, after the clock: saves the delta or replaces it.
+  void frame(FramePacket& f);
+  // Once per fixed tick, before anything reads actions.
+  void tick();
+
+  [[nodiscard]] InputReplayMode mode() const noexcept { return mode_; }
+  [[nodiscard]] bool recording() const noexcept {
+    return mode_ == InputReplayMode::Record;
+  }
+  [[nodiscard]] bool replaying() const noexcept {
+    return mode_ == InputReplayMode::Replay;
+  }
+  [[nodiscard]] bool finished() const noexcept { return finished_; }
+  [[nodiscard]] u64 seed() const noexcept { return seed_; }
+  [[nodiscard]] Frame tickCount() const noexcept { return tickCount_; }
+
+ private:
+  enum class Record : u8 { Frame = 1, Tick, Repeat, End };
+
+  static constexpr u32 kMagic = 0x52494c52;  // "RLIR".
+  static constexpr u16 kVersion = 1;
+
+  InputReplayMode mode_{InputReplayMode::Off};
+  bool finished_{false};
+  u64 seed_{0};
+  Frame tickCount_{0};
+  f64 time_{.0};
+  std::ofstream os_{};
+  std::ifstream is_{};
+  ActionFrame frame_{};
+  ActionFrame prevFrame_{};
+  InputMouseScroll scroll_{InputMouseScroll::zero()};
+  InputMouseScroll prevScroll_{InputMouseScroll::zero()};
+
+  InputReplaySystem() = default;
+
+  void writeTick();
+  bool readTick();
+  void finish(std::string_view reason);
+};
+}  // namespace rl
+
+#define RL_INPUTREPLAY (::rl::InputReplaySystem::instance())
+#define RL_CINPUTREPLAY                         \
+  (static_cast<const ::rl::InputReplaySystem&>( \
+      ::rl::InputReplaySystem::instance()))
+
+#endif  // ENGINE_INPUT_INPUT_REPLAY_SYSTEM_H_
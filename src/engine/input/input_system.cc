@@ -57,6 +57,7 @@ void InputSystem::init(void* window) {
   window_ = window;
   platform_ = std::make_unique<PlatformCtx>();
   platform_->window = static_cast<GLFWwindow*>(window_);
+  if (!window_) return;
   initControllers();
   bindCallbacks();
 }
@@ -72,6 +73,12 @@ void InputSystem::shutdown() {
 
 void InputSystem::poll() {
   state_.newFrame();
+
+  if (!window_) {
+    state_.resetMods();
+    return;
+  }
+
   glfwPollEvents();
   pollControllers();
   state_.resetMods();
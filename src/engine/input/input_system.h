@@ -24,6 +24,8 @@ class InputSystem {
  public:
   static InputSystem& instance();
 
+  // A null window selects the null input source: nothing is polled and every
+  // query reports an idle device.
   void init(void* window);
   void shutdown();
 
@@ -56,6 +58,9 @@ class InputSystem {
   InputMousePos mousePosition() const noexcept { return state_.mousePos; }
   InputMousePos mouseDelta() const noexcept { return state_.mouseDelta; }
   InputMouseScroll scrollDelta() const noexcept { return state_.mouseScroll; }
+  void scrollDelta(const InputMouseScroll& s) noexcept {
+    state_.mouseScroll = s;
+  }
 
   bool controllerMode() const noexcept { return state_.controllerMode; }
 
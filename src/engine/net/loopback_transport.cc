@@ -0,0 +1,91 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "loopback_transport.h"
+////////////////////////////////////////////////////////////////////////////////
+
+namespace rl {
+void LoopbackTransport::open(const LoopbackDesc& desc) {
+  close();
+  desc_ = desc;
+  rng_.seed(desc.seed);
+}
+
+void LoopbackTransport::close() {
+  for (auto& p : inFlight_) free_.push_back(std::move(p.bytes));
+  inFlight_.clear();
+  stats_ = {};
+  seq_ = 0;
+}
+
+void LoopbackTransport::send(NetPeer from, std::span<const std::byte> data,
+                             f64 now) {
+  RL_ASSERT(from < kNetPeerCount, "LoopbackTransport::send: Invalid peer ",
+            from, "!");
+  ++stats_.sent;
+  stats_.bytes += data.size();
+
+  // Case: draw both values even for dropped packets, so the loss rate does
+  // not shift the delays of the packets that make it.
+  auto roll = rng_.next01f();
+  auto jitter = desc_.jitter > .0 ? rng_.next01() * desc_.jitter : .0;
+
+  if (roll < desc_.loss) {
+    ++stats_.lost;
+    return;
+  }
+
+  Packet p{
+      .due = now + desc_.latency + jitter,
+      .seq = seq_++,
+      .to = static_cast<NetPeer>(1 - from),
+  };
+
+  if (!free_.empty()) {
+    p.bytes = std::move(free_.back());
+    free_.pop_back();
+  }
+
+  p.bytes.assign(data.begin(), data.end());
+  inFlight_.push_back(std::move(p));
+}
+
+bool LoopbackTransport::receive(NetPeer to, f64 now,
+                                std::vector<std::byte>& out) {
+  auto best = inFlight_.end();
+
+  for (auto it = inFlight_.begin(); it != inFlight_.end(); ++it) {
+    if (it->to != to || it->due > now) continue;
+
+    if (best == inFlight_.end() || it->due < best->due ||
+        (it->due == best->due && it->seq < best->seq)) {
+      best = it;
+    }
+  }
+
+  if (best == inFlight_.end()) return false;
+  out.swap(best->bytes);
+  free_.push_back(std::move(best->bytes));
+  if (best != inFlight_.end() - 1) *best = std::move(inFlight_.back());
+  inFlight_.pop_back();
+  ++stats_.delivered;
+  return true;
+}
+}  // namespace rl
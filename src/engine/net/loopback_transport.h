@@ -0,0 +1,72 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ENGINE_NET_LOOPBACK_TRANSPORT_H_
+#define ENGINE_NET_LOOPBACK_TRANSPORT_H_
+
+#include "engine/common.h"
+#include "engine/core/random.h"
+
+namespace rl {
+using NetPeer = u8;
+constexpr NetPeer kNetPeerCount = 2;
+
+struct LoopbackDesc {
+  f64 latency{.0};  // One way, in seconds.
+  f64 jitter{.0};   // Uniform extra delay in [0, jitter), in seconds.
+  f32 loss{.0f};    // Drop probability in [0, 1].
+  u64 seed{0};
+};
+
+struct LoopbackStats {
+  u64 sent{0};
+  u64 lost{0};
+  u64 delivered{0};
+  u64 bytes{0};
+};
+
+// In-process datagram link between two peers. Packets are delayed, reordered
+// by jitter and dropped like UDP would, from a seeded generator so a run is
+// reproducible.
+class LoopbackTransport {
+ public:
+  void open(const LoopbackDesc& desc);
+  void close();
+
+  void send(NetPeer from, std::span<const std::byte> data, f64 now);
+  // Pops the next packet due for peer at now. Out is overwritten.
+  bool receive(NetPeer to, f64 now, std::vector<std::byte>& out);
+
+  [[nodiscard]] const LoopbackDesc& desc() const noexcept { return desc_; }
+  [[nodiscard]] const LoopbackStats& stats() const noexcept { return stats_; }
+
+ private:
+  struct Packet {
+    f64 due{.0};
+    u64 seq{0};
+    NetPeer to{0};
+    std::vector<std::byte> bytes{};
+  };
+
+  LoopbackDesc desc_{};
+  LoopbackStats stats_{};
+  Splitmix64 rng_{};
+  u64 seq_{0};
+  std::vector<Packet> inFlight_{};
+  std::vector<std::vector<std::byte>> free_{};
+};
+}  // namespace rl
+
+#endif  // ENGINE_NET_LOOPBACK_TRANSPORT_H_
@@ -0,0 +1,384 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "rollback_system.h"
+////////////////////////////////////////////////////////////////////////////////
+
+#include "engine/core/log.h"
+#include "engine/input/action_system.h"
+#include "engine/physics/physics_system.h"
+#include "engine/snapshot/snapshot_system.h"
+#include "engine/sound/sound_system.h"
+
+namespace rl {
+namespace internal {
+enum class RollbackPacket : u8 { Inputs = 1, Ack };
+
+void writeActionFrame(SnapshotWriter& w, const ActionFrame& a) {
+  w.write(a.digital);
+  w.write(a.analog);
+  w.write(a.axes);
+}
+
+bool readActionFrame(SnapshotReader& r, ActionFrame& a) {
+  return r.read(a.digital) && r.read(a.analog) && r.read(a.axes);
+}
+
+template <typename T>
+void splitByKey(const std::vector<T>& in, std::vector<T>& local,
+                std::vector<T>& remote, PlayerSlot remoteSlot) {
+  local.clear();
+  remote.clear();
+
+  for (const auto& v : in) {
+    ActionKey key{};
+
+    if constexpr (std::is_same_v<T, ActionKey>) {
+      key = v;
+    } else {
+      key = v.key;
+    }
+
+    auto slot = playerSlotFromActionScope(actionScopeFromKey(key));
+    (slot == remoteSlot ? remote : local).push_back(v);
+  }
+}
+
+template <typename T>
+void mergeByKey(const std::vector<T>& a, const std::vector<T>& b,
+                std::vector<T>& out) {
+  out.resize(a.size() + b.size());
+
+  if constexpr (std::is_same_v<T, ActionKey>) {
+    std::merge(a.begin(), a.end(), b.begin(), b.end(), out.begin());
+  } else {
+    std::merge(a.begin(), a.end(), b.begin(), b.end(), out.begin(),
+               [](const T& l, const T& r) { return l.key < r.key; });
+  }
+}
+}  // namespace internal
+
+RollbackSystem& RollbackSystem::instance() {
+  static RollbackSystem inst;
+  return inst;
+}
+
+void RollbackSystem::init() {
+  RL_LOG_DEBUG("RollbackSystem::init");
+  stats_ = {};
+}
+
+void RollbackSystem::shutdown() {
+  RL_LOG_DEBUG("RollbackSystem::shutdown");
+  stop();
+}
+
+bool RollbackSystem::start(const RollbackDesc& desc) {
+  stop();
+
+  if (desc.maxRollback == 0) {
+    RL_LOG_ERR("RollbackSystem::start: Max rollback must be at least 1!");
+    return false;
+  }
+
+  desc_ = desc;
+  // Case: confirmed input can arrive up to maxRollback ticks ahead, and
+  // snapshots are kept up to maxRollback ticks behind.
+  auto size = 2 * (static_cast<usize>(desc.maxRollback) + 1);
+  slots_.assign(size, {});
+  peerSlots_.assign(size, {});
+  link_.open(desc.link);
+
+  tick_ = 0;
+  pending_ = 0;
+  peerTick_ = static_cast<Frame>(-1);
+  peerAck_ = 0;
+  stats_ = {};
+  started_ = false;
+  active_ = true;
+
+  RL_LOG_INFO("RollbackSystem::start: Remote slot ",
+              static_cast<u32>(desc.remoteSlot), ", ",
+              desc.maxRollback, " ticks max rollback, ",
+              desc.link.latency * 1000.0, "ms latency, ",
+              desc.link.jitter * 1000.0, "ms jitter, ",
+              desc.link.loss * 100.0f, "% loss.");
+  return true;
+}
+
+void RollbackSystem::stop() {
+  if (RL_CACTIONSYS.latched() == &latched_) RL_ACTIONSYS.latch(nullptr);
+  active_ = false;
+  started_ = false;
+  resimulating_ = false;
+  slots_.clear();
+  peerSlots_.clear();
+  link_.close();
+}
+
+bool RollbackSystem::tick(const FramePacket& f) {
+  if (!active_) return true;
+
+  // Case: the scene is loaded through queued messages that the first tick
+  // delivers. Snapshots only cover systems, so the session starts after it.
+  if (!started_) {
+    started_ = true;
+    return true;
+  }
+
+  if (RL_CACTIONSYS.latched() == &latched_) RL_ACTIONSYS.latch(nullptr);
+  const auto* in = RL_CACTIONSYS.latched();
+
+  if (!in) {
+    RL_CACTIONSYS.capture(live_);
+    in = &live_;
+  }
+
+  split(*in, localPart_, remotePart_);
+
+  auto now = f.time;
+  updatePeer(now);
+  auto from = receive(now);
+
+  packet_.clear();
+  SnapshotWriter w{packet_};
+  w.write(internal::RollbackPacket::Ack);
+  w.write(pending_);
+  link_.send(kLocalPeer, packet_, now);
+
+  if (from < tick_ && !rollback(from)) {
+    stop();
+    return true;
+  }
+
+  // Case: too far ahead of the remote peer to roll back if it disagrees.
+  if (pending_ + desc_.maxRollback <= tick_) {
+    ++stats_.stalls;
+    return false;
+  }
+
+  auto& s = slot(tick_);
+
+  if (s.tick != tick_) {
+    s.tick = tick_;
+    s.confirmed = false;
+  }
+
+  s.local = localPart_;
+  if (!s.confirmed) s.remote = predict(tick_);
+  s.frame = f.frame;
+  s.delta = f.delta;
+  s.time = f.time;
+  RL_CSNAPSHOTSYS.capture(s.state, tick_);
+
+  merge(s.local, s.remote, latched_);
+  RL_ACTIONSYS.latch(&latched_);
+  ++tick_;
+  ++stats_.ticks;
+  return true;
+}
+
+void RollbackSystem::report() const {
+  const auto& l = link_.stats();
+  auto ticks = static_cast<f64>(stats_.resimTicks);
+  auto rollbacks = static_cast<f64>(stats_.rollbacks);
+  auto perTick = ticks > .0 ? stats_.resimSeconds / ticks : .0;
+  auto perRollback = rollbacks > .0 ? stats_.resimSeconds / rollbacks : .0;
+  // Case: how many ticks one fixed step can re-simulate at the measured cost.
+  auto affordable = perTick > .0 ? static_cast<u64>(kFixedStep / perTick) : 0;
+
+  RL_LOG_INFO("RollbackSystem: ", stats_.ticks, " ticks, ", stats_.stalls,
+              " stalls, ", stats_.rollbacks, " rollbacks, ",
+              stats_.resimTicks, " ticks re-simulated (max depth ",
+              stats_.maxDepth, ").");
+  RL_LOG_INFO("RollbackSystem: Re-simulation ", perRollback * 1e6,
+              "us per rollback (max ", stats_.maxResimSeconds * 1e6, "us), ",
+              perTick * 1e6, "us per tick, ~", affordable,
+              " ticks per fixed step.");
+  RL_LOG_INFO("RollbackSystem: Link ", l.sent, " sent, ", l.lost, " lost, ",
+              l.delivered, " delivered, ", l.bytes, " bytes.");
+}
+
+void RollbackSystem::split(const ActionFrame& in, ActionFrame& local,
+                           ActionFrame& remote) const {
+  auto s = desc_.remoteSlot;
+  internal::splitByKey(in.digital, local.digital, remote.digital, s);
+  internal::splitByKey(in.analog, local.analog, remote.analog, s);
+  internal::splitByKey(in.axes, local.axes, remote.axes, s);
+}
+
+void RollbackSystem::merge(const ActionFrame& local, const ActionFrame& remote,
+                           ActionFrame& out) const {
+  internal::mergeByKey(local.digital, remote.digital, out.digital);
+  internal::mergeByKey(local.analog, remote.analog, out.analog);
+  internal::mergeByKey(local.axes, remote.axes, out.axes);
+}
+
+const ActionFrame& RollbackSystem::predict(Frame t) {
+  // Case: the remote peer most likely still holds its last confirmed input.
+  for (auto k = t; k > 0 && k + desc_.maxRollback >= t; --k) {
+    const auto& s = slot(k - 1);
+    if (s.tick == k - 1 && s.confirmed) return s.remote;
+  }
+
+  predicted_.clear();
+  return predicted_;
+}
+
+void RollbackSystem::updatePeer(f64 now) {
+  while (link_.receive(kRemotePeer, now, packet_)) {
+    SnapshotReader r{packet_};
+    auto kind = internal::RollbackPacket::Ack;
+    Frame ack{0};
+
+    if (r.read(kind) && kind == internal::RollbackPacket::Ack &&
+        r.read(ack)) {
+      peerAck_ = std::max(peerAck_, ack);
+    }
+  }
+
+  if (peerTick_ != tick_) {
+    auto& p = peerSlot(tick_);
+    p.tick = tick_;
+
+    if (desc_.remoteInput) {
+      p.input.clear();
+      desc_.remoteInput(tick_, p.input, desc_.remoteUserData);
+    } else {
+      p.input = remotePart_;
+    }
+
+    peerTick_ = tick_;
+  }
+
+  // Case: everything not acked yet is resent, so a lost packet is covered by
+  // the next one.
+  auto window = static_cast<Frame>(peerSlots_.size());
+  auto first = std::max(peerAck_, tick_ + 1 > window ? tick_ + 1 - window : 0);
+  if (first > tick_) return;
+
+  packet_.clear();
+  SnapshotWriter w{packet_};
+  w.write(internal::RollbackPacket::Inputs);
+  w.write(first);
+  w.write(static_cast<u32>(tick_ + 1 - first));
+
+  for (auto t = first; t <= tick_; ++t) {
+    internal::writeActionFrame(w, peerSlot(t).input);
+  }
+
+  link_.send(kRemotePeer, packet_, now);
+}
+
+Frame RollbackSystem::receive(f64 now) {
+  auto from = static_cast<Frame>(-1);
+
+  while (link_.receive(kLocalPeer, now, packet_)) {
+    SnapshotReader r{packet_};
+    auto kind = internal::RollbackPacket::Ack;
+    Frame first{0};
+    u32 count{0};
+
+    if (!r.read(kind) || kind != internal::RollbackPacket::Inputs ||
+        !r.read(first) || !r.read(count)) {
+      continue;
+    }
+
+    for (u32 i = 0; i < count; ++i) {
+      if (!internal::readActionFrame(r, packetFrame_)) break;
+      confirm(first + i, packetFrame_, from);
+    }
+  }
+
+  while (slot(pending_).tick == pending_ && slot(pending_).confirmed) {
+    ++pending_;
+  }
+
+  return from;
+}
+
+void RollbackSystem::confirm(Frame t, const ActionFrame& input,
+                             Frame& rollbackFrom) {
+  if (t < pending_) return;
+  // Case: too far ahead to keep without evicting a needed snapshot. The peer
+  // resends it until acked.
+  if (t > tick_ + desc_.maxRollback) return;
+
+  if (t + desc_.maxRollback < tick_) {
+    ++stats_.lateInputs;
+    RL_LOG_WARN("RollbackSystem::confirm: Input for tick ", t,
+                " is too old to roll back to!");
+    return;
+  }
+
+  auto& s = slot(t);
+  if (s.tick == t && s.confirmed) return;
+
+  if (t < tick_) {
+    RL_ASSERT(s.tick == t, "RollbackSystem::confirm: Tick ", t,
+              " was simulated but has no slot!");
+    if (!sameActionFrame(s.remote, input)) {
+      rollbackFrom = std::min(rollbackFrom, t);
+    }
+  }
+
+  s.tick = t;
+  s.remote = input;
+  s.confirmed = true;
+}
+
+bool RollbackSystem::rollback(Frame from) {
+  auto start = std::chrono::steady_clock::now();
+
+  if (!RL_SNAPSHOTSYS.restore(slot(from).state)) {
+    RL_LOG_ERR("RollbackSystem::rollback: Could not restore tick ", from,
+               ", stopping the session!");
+    return false;
+  }
+
+  resimulating_ = true;
+  RL_SOUNDSYS.muteOnce(true);
+
+  for (auto t = from; t < tick_; ++t) {
+    auto& s = slot(t);
+    if (t != from) RL_CSNAPSHOTSYS.capture(s.state, t);
+    if (!s.confirmed) s.remote = predict(t);
+    merge(s.local, s.remote, latched_);
+    RL_ACTIONSYS.latch(&latched_);
+    RL_PHYSICSSYS.step({.frame = s.frame, .delta = s.delta, .time = s.time});
+  }
+
+  RL_SOUNDSYS.muteOnce(false);
+  resimulating_ = false;
+
+  auto seconds = std::chrono::duration<f64>(std::chrono::steady_clock::now() -
+                                            start)
+                     .count();
+  auto depth = static_cast<u32>(tick_ - from);
+  ++stats_.rollbacks;
+  stats_.resimTicks += depth;
+  stats_.lastDepth = depth;
+  stats_.maxDepth = std::max(stats_.maxDepth, depth);
+  stats_.lastResimSeconds = seconds;
+  stats_.maxResimSeconds = std::max(stats_.maxResimSeconds, seconds);
+  stats_.resimSeconds += seconds;
+  return true;
+}
+}  // namespace rl
@@ -0,0 +1,148 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ENGINE_NET_ROLLBACK_SYSTEM_H_
+#define ENGINE_NET_ROLLBACK_SYSTEM_H_
+
+#include "engine/common.h"
+#include "engine/core/frame.h"
+#include "engine/input/action.h"
+#include "engine/net/loopback_transport.h"
+#include "engine/player/player.h"
+#include "engine/snapshot/snapshot.h"
+
+namespace rl {
+// Input of the loopback peer for one tick, called once per tick it sends.
+using RollbackInputFn = void (*)(Frame tick, ActionFrame& out,
+                                 void* userData);
+
+struct RollbackDesc {
+  bool enabled{false};
+  PlayerSlot remoteSlot{1};
+  u32 maxRollback{8};  // Ticks predicted ahead of the last confirmed input.
+  LoopbackDesc link{};
+  // When null, the loopback peer sends the remote slot's live actions.
+  RollbackInputFn remoteInput{nullptr};
+  void* remoteUserData{nullptr};
+};
+
+struct RollbackStats {
+  Frame ticks{0};
+  u64 stalls{0};
+  u64 rollbacks{0};
+  u64 resimTicks{0};
+  u64 lateInputs{0};
+  u32 lastDepth{0};
+  u32 maxDepth{0};
+  f64 lastResimSeconds{.0};
+  f64 maxResimSeconds{.0};
+  f64 resimSeconds{.0};
+};
+
+// Two-peer rollback session over the fixed step. The remote slot's input is
+// predicted (last confirmed input held), each tick's state is kept in a ring
+// of snapshots, and a misprediction restores the mispredicted tick and
+// re-simulates up to the present within the same frame.
+class RollbackSystem {
+ public:
+  static RollbackSystem& instance();
+
+  void init();
+  void shutdown();
+
+  bool start(const RollbackDesc& desc);
+  void stop();
+
+  // Once per fixed tick, after input replay. Settles remote input, rolls back
+  // on misprediction and latches the input of the tick about to run. False
+  // while stalled on the remote peer: the tick must not run.
+  bool tick(const FramePacket& f);
+
+  void report() const;
+
+  [[nodiscard]] bool active() const noexcept { return active_; }
+  [[nodiscard]] bool resimulating() const noexcept { return resimulating_; }
+  [[nodiscard]] Frame currentTick() const noexcept { return tick_; }
+  [[nodiscard]] const RollbackStats& stats() const noexcept { return stats_; }
+  [[nodiscard]] const LoopbackStats& linkStats() const noexcept {
+    return link_.stats();
+  }
+
+ private:
+  static constexpr NetPeer kLocalPeer = 0;
+  static constexpr NetPeer kRemotePeer = 1;
+
+  struct Slot {
+    Frame tick{static_cast<Frame>(-1)};
+    ActionFrame local{};
+    ActionFrame remote{};  // Confirmed, or the prediction simulated with.
+    bool confirmed{false};
+    Snapshot state{};  // Before the tick runs.
+    // Of the packet the tick first ran with, to run it again the same way.
+    Frame frame{0};
+    f64 delta{.0};
+    f64 time{.0};
+  };
+
+  struct PeerSlot {
+    Frame tick{static_cast<Frame>(-1)};
+    ActionFrame input{};
+  };
+
+  RollbackDesc desc_{};
+  bool active_{false};
+  bool started_{false};
+  bool resimulating_{false};
+  Frame tick_{0};
+  Frame pending_{0};  // First tick without confirmed remote input.
+  RollbackStats stats_{};
+  LoopbackTransport link_{};
+  std::vector<Slot> slots_{};
+  ActionFrame live_{};
+  ActionFrame localPart_{};
+  ActionFrame remotePart_{};
+  ActionFrame predicted_{};
+  ActionFrame latched_{};
+  ActionFrame packetFrame_{};
+  std::vector<std::byte> packet_{};
+
+  // Loopback stand-in for the remote simulation.
+  std::vector<PeerSlot> peerSlots_{};
+  Frame peerTick_{static_cast<Frame>(-1)};
+  Frame peerAck_{0};
+
+  RollbackSystem() = default;
+
+  Slot& slot(Frame t) { return slots_[t % slots_.size()]; }
+  PeerSlot& peerSlot(Frame t) { return peerSlots_[t % peerSlots_.size()]; }
+
+  void split(const ActionFrame& in, ActionFrame& local,
+             ActionFrame& remote) const;
+  void merge(const ActionFrame& local, const ActionFrame& remote,
+             ActionFrame& out) const;
+  const ActionFrame& predict(Frame t);
+
+  void updatePeer(f64 now);
+  Frame receive(f64 now);
+  void confirm(Frame t, const ActionFrame& input, Frame& rollbackFrom);
+  bool rollback(Frame from);
+};
+}  // namespace rl
+
+#define RL_ROLLBACK (::rl::RollbackSystem::instance())
+#define RL_CROLLBACK \
+  (static_cast<const ::rl::RollbackSystem&>(::rl::RollbackSystem::instance()))
+
+#endif  // ENGINE_NET_ROLLBACK_SYSTEM_H_
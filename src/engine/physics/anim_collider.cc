@@ -21,6 +21,8 @@
 #include "anim_collider.h"
 ////////////////////////////////////////////////////////////////////////////////
 
+#include "engine/physics/physics_utils.h"
+
 namespace rl {
 const AnimColliderSample* sampleTrack(const AnimColliderTrack& track, usize i) {
   const auto& samples = track.samples;
@@ -28,4 +30,43 @@ const AnimColliderSample* sampleTrack(const AnimColliderTrack& track, usize i) {
   i = std::min(samples.size() - 1, i);
   return &samples[i];
 }
+
+AnimColliderFrames flattenColliderSet(const AnimColliderSet& set) {
+  AnimColliderFrames out{
+      .frameCount = 0,
+      .hitCount = set.hits.size(),
+      .hurtCount = set.hurts.size(),
+  };
+
+  for (const auto& t : set.hits) {
+    out.frameCount = std::max(out.frameCount, t.samples.size());
+  }
+
+  for (const auto& t : set.hurts) {
+    out.frameCount = std::max(out.frameCount, t.samples.size());
+  }
+
+  auto stride = out.stride();
+  if (out.frameCount == 0 || stride == 0) return out;
+  out.colliders.resize(2 * out.frameCount * stride, Collider{});
+
+  auto write = [&](usize frame, usize slot, const AnimColliderTrack& track) {
+    const auto* s = sampleTrack(track, frame);
+    if (!s) return;
+    auto idx = frame * stride + slot;
+    auto flippedIdx = (out.frameCount + frame) * stride + slot;
+    out.colliders[idx] = s->collider;
+    out.colliders[flippedIdx] = flipX(s->collider);
+  };
+
+  for (usize f = 0; f < out.frameCount; ++f) {
+    for (usize i = 0; i < out.hitCount; ++i) write(f, i, set.hits[i]);
+
+    for (usize i = 0; i < out.hurtCount; ++i) {
+      write(f, out.hitCount + i, set.hurts[i]);
+    }
+  }
+
+  return out;
+}
 }  // namespace rl
\ No newline at end of file
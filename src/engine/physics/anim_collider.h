@@ -33,7 +33,26 @@ struct AnimColliderSet {
   std::vector<AnimColliderTrack> hits{};
 };
 
+// Every track of a set sampled per frame, hits first then hurts, with an
+// extra flipped copy. Colliders with an unknown shape are inactive.
+struct AnimColliderFrames {
+  usize frameCount{0};
+  usize hitCount{0};
+  usize hurtCount{0};
+  std::vector<Collider> colliders{};
+
+  usize stride() const noexcept { return hitCount + hurtCount; }
+
+  std::span<const Collider> at(usize frame, bool flipped) const noexcept {
+    if (frameCount == 0) return {};
+    frame = std::min(frame, frameCount - 1);
+    auto block = (flipped ? frameCount : 0) + frame;
+    return {colliders.data() + block * stride(), stride()};
+  }
+};
+
 const AnimColliderSample* sampleTrack(const AnimColliderTrack& track, usize i);
+AnimColliderFrames flattenColliderSet(const AnimColliderSet& set);
 }  // namespace rl
 
 #endif  // ENGINE_PHYSICS_ANIM_COLLIDER_H_
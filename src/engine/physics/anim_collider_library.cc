@@ -62,6 +62,13 @@ const AnimColliderProfileResource* AnimColliderLibrary::load(
         "AnimColliderLibrary::load: Failed to load collider profile with id: ",
         id, "!");
 
+    res->flatPerAnim.clear();
+    res->flatPerAnim.reserve(res->perAnim.size());
+
+    for (const auto& set : res->perAnim) {
+      res->flatPerAnim.push_back(flattenColliderSet(set));
+    }
+
     return res;
   });
 }
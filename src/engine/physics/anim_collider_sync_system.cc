@@ -49,49 +49,54 @@ void AnimColliderSyncSystem::shutdown() {
   RL_LOG_DEBUG("AnimColliderSyncSystem::shutdown");
   hRigPool_.clear();
   rigs_.clear();
+  animatorToRig_.clear();
 }
 
-void AnimColliderSyncSystem::tick(const FramePacket&) {
-  for (auto& r : rigs_) {
-    if (!hRigPool_.alive(r.handle)) continue;
-    auto frame = RL_CANIMSYS.animFrame(r.animator);
-
-    if (frame == kInvalidAnimFrame) {
-      deactivate(r);
-      continue;
-    }
+void AnimColliderSyncSystem::save(SnapshotWriter& w) const {
+  hRigPool_.save(w);
+  w.write(static_cast<u32>(rigs_.size()));
+
+  for (const auto& r : rigs_) {
+    w.write(r.ref);
+    w.write(r.handle);
+    w.write(r.animator);
+    w.write(r.animIdx);
+    w.write(r.animSet);
+    w.write(r.profile);
+    w.write(r.hurtHandles);
+    w.write(r.hitHandles);
+  }
 
-    auto animSetId = RL_CANIMSYS.animSet(r.animator);
+  w.write(animatorToRig_);
+}
 
-    if (!r.animSet || animSetId != r.animSet->id) {
-      if (!animSetId) {
-        r.animSet = nullptr;
-        r.profile = nullptr;
-      } else {
-        r.animSet = RL_CANIMLIB.get(animSetId);
-        if (r.animSet && r.animSet->colliderProfile) {
-          r.profile = RL_CANIMCOLLIB.get(r.animSet->colliderProfile);
-        } else {
-          r.profile = nullptr;
-        }
-      }
+bool AnimColliderSyncSystem::restore(SnapshotReader& r) {
+  u32 count{0};
+  if (!hRigPool_.restore(r) || !r.read(count)) return false;
+  rigs_.resize(count);
+
+  for (auto& rig : rigs_) {
+    if (!r.read(rig.ref) || !r.read(rig.handle) || !r.read(rig.animator) ||
+        !r.read(rig.animIdx) || !r.read(rig.animSet) ||
+        !r.read(rig.profile) || !r.read(rig.hurtHandles) ||
+        !r.read(rig.hitHandles)) {
+      return false;
     }
+  }
 
-    if (!r.animSet || !r.profile) {
-      deactivate(r);
-      continue;
-    }
-
-    auto animIdx = RL_CANIMSYS.animIdx(r.animator);
-    r.animIdx = animIdx;
-
-    if (r.animIdx == kInvalidIndex || r.animIdx >= r.profile->perAnim.size()) {
-      deactivate(r);
-      continue;
-    }
+  return r.read(animatorToRig_);
+}
 
-    const auto& colliderSet = r.profile->perAnim[r.animIdx];
-    update(frame, colliderSet, r);
+void AnimColliderSyncSystem::tick(const FramePacket&) {
+  // Case: rigs only change when their animator does, so only the animators
+  // reported by the anim system are visited.
+  for (auto animator : RL_CANIMSYS.frameChanges()) {
+    if (animator.index >= animatorToRig_.size()) continue;
+    auto h = animatorToRig_[animator.index];
+    if (!h || !hRigPool_.alive(h)) continue;
+    auto& r = rigs_[h.index];
+    if (r.animator != animator) continue;
+    sync(r);
   }
 }
 
@@ -117,6 +122,8 @@ AnimColliderRigHandle AnimColliderSyncSystem::generate(
   r.profile = colliderProfile;
 
   r.ref = desc.ref;
+  ensureCapacity(animatorToRig_, desc.animator.index);
+  animatorToRig_[desc.animator.index] = h;
 
   usize maxHits = 0;
   usize maxHurts = 0;
@@ -165,11 +172,17 @@ AnimColliderRigHandle AnimColliderSyncSystem::generate(
     });
   }
 
+  sync(r);
   return h;
 }
 
 void AnimColliderSyncSystem::destroy(AnimColliderRigHandle h) {
   auto* r = rig(h);
+  auto animIdx = r->animator.index;
+
+  if (animIdx < animatorToRig_.size() && animatorToRig_[animIdx] == h) {
+    animatorToRig_[animIdx] = kInvalidHandle;
+  }
 
   for (auto hit : r->hitHandles) {
     if (hit) RL_HITBOXSYS.destroy(hit);
@@ -183,38 +196,74 @@ void AnimColliderSyncSystem::destroy(AnimColliderRigHandle h) {
   hRigPool_.destroy(h);
 }
 
-void AnimColliderSyncSystem::update(AnimFrame frame, const AnimColliderSet& set,
+void AnimColliderSyncSystem::sync(AnimColliderRig& r) {
+  auto frame = RL_CANIMSYS.animFrame(r.animator);
+
+  if (frame == kInvalidAnimFrame) {
+    deactivate(r);
+    return;
+  }
+
+  auto animSetId = RL_CANIMSYS.animSet(r.animator);
+
+  if (!r.animSet || animSetId != r.animSet->id) {
+    if (!animSetId) {
+      r.animSet = nullptr;
+      r.profile = nullptr;
+    } else {
+      r.animSet = RL_CANIMLIB.get(animSetId);
+      if (r.animSet && r.animSet->colliderProfile) {
+        r.profile = RL_CANIMCOLLIB.get(r.animSet->colliderProfile);
+      } else {
+        r.profile = nullptr;
+      }
+    }
+  }
+
+  if (!r.animSet || !r.profile) {
+    deactivate(r);
+    return;
+  }
+
+  r.animIdx = RL_CANIMSYS.animIdx(r.animator);
+
+  if (r.animIdx == kInvalidIndex ||
+      r.animIdx >= r.profile->flatPerAnim.size()) {
+    deactivate(r);
+    return;
+  }
+
+  update(frame, r.profile->flatPerAnim[r.animIdx], r);
+}
+
+void AnimColliderSyncSystem::update(AnimFrame frame,
+                                    const AnimColliderFrames& frames,
                                     AnimColliderRig& r) {
-  auto hitCount = set.hits.size();
-  auto hurtCount = set.hurts.size();
-  auto flippedX = RL_CANIMSYS.flippedX(r.animator);
+  auto colliders =
+      frames.at(static_cast<usize>(frame), RL_CANIMSYS.flippedX(r.animator));
+  auto hitCount = colliders.empty() ? 0 : frames.hitCount;
+  auto hurtCount = colliders.empty() ? 0 : frames.hurtCount;
 
   for (usize i = 0; i < hitCount; ++i) {
-    const auto& track = set.hits[i];
-    const auto* s = sampleTrack(track, static_cast<usize>(frame));
+    const auto& c = colliders[i];
     auto* h = RL_HITBOXSYS.hitbox(r.hitHandles[i]);
+    if (!h) continue;
 
-    if (!h || !s || s->collider.shape == ColliderShape::Unknown) {
+    if (c.shape == ColliderShape::Unknown) {
       h->deactivate();
       continue;
     }
 
     h->activate();
-    h->collider = flippedX ? flipX(s->collider) : s->collider;
+    h->collider = c;
   }
 
   for (usize i = 0; i < hurtCount; ++i) {
-    const auto& track = set.hurts[i];
-    const auto* s = sampleTrack(track, static_cast<usize>(frame));
+    const auto& c = colliders[hitCount + i];
     auto* h = RL_HITBOXSYS.hurtbox(r.hurtHandles[i]);
-
-    if (!h || !s) {
-      h->active = false;
-      continue;
-    }
-
-    h->active = true;
-    h->collider = flippedX ? flipX(s->collider) : s->collider;
+    if (!h) continue;
+    h->active = c.shape != ColliderShape::Unknown;
+    h->collider = c;
   }
 
   for (usize i = hitCount; i < r.hitHandles.size(); ++i) {
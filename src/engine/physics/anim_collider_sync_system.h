@@ -20,6 +20,7 @@
 #include "engine/core/frame.h"
 #include "engine/core/handle.h"
 #include "engine/physics/anim_collider_sync.h"
+#include "engine/snapshot/snapshot.h"
 
 namespace rl {
 class AnimColliderSyncSystem {
@@ -29,6 +30,9 @@ class AnimColliderSyncSystem {
   void init();
   void shutdown();
 
+  void save(SnapshotWriter& w) const;
+  bool restore(SnapshotReader& r);
+
   void tick(const FramePacket&);
 
   [[nodiscard]] AnimColliderRigHandle generate(const AnimColliderRigDesc& desc);
@@ -37,10 +41,13 @@ class AnimColliderSyncSystem {
  private:
   HandlePool<AnimColliderRigTag> hRigPool_{};
   std::vector<AnimColliderRig> rigs_{};
+  std::vector<AnimColliderRigHandle> animatorToRig_{};
 
   AnimColliderSyncSystem() = default;
 
-  void update(AnimFrame frame, const AnimColliderSet& set, AnimColliderRig& r);
+  void sync(AnimColliderRig& r);
+  void update(AnimFrame frame, const AnimColliderFrames& frames,
+              AnimColliderRig& r);
   void deactivate(AnimColliderRig& r);
 
   AnimColliderRig* rig(AnimColliderRigHandle h);
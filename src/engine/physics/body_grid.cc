@@ -0,0 +1,83 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "body_grid.h"
+////////////////////////////////////////////////////////////////////////////////
+
+#include "engine/physics/physics_utils.h"
+
+namespace rl {
+void BodyGrid::build(std::span<const PhysicsBody> bodies) {
+  items_.clear();
+  cells_.assign(bodies.size(), 0);
+  reach_ = .0f;
+
+  auto min = Position{std::numeric_limits<Distance>::max(),
+                      std::numeric_limits<Distance>::max()};
+  auto max = -min;
+  usize count = 0;
+
+  for (const auto& b : bodies) {
+    if (!b.handle) continue;
+    auto a = aabbOf(b.wCollider);
+    min = {std::min(min.x, a.center.x), std::min(min.y, a.center.y)};
+    max = {std::max(max.x, a.center.x), std::max(max.y, a.center.y)};
+    reach_ = std::max({reach_, a.halfExtents.x, a.halfExtents.y});
+    ++count;
+  }
+
+  if (count == 0) {
+    w_ = h_ = 0;
+    return;
+  }
+
+  origin_ = min;
+  auto extent = max - min;
+  cellSize_ = kMinCellSize_;
+  auto area = (extent.x + cellSize_) * (extent.y + cellSize_);
+  auto cap = static_cast<Distance>(count * kMaxCellsPerBody_);
+
+  if (area > cap * cellSize_ * cellSize_) {
+    cellSize_ = std::sqrt(area / cap);
+  }
+
+  w_ = static_cast<usize>(extent.x / cellSize_) + 1;
+  h_ = static_cast<usize>(extent.y / cellSize_) + 1;
+  starts_.assign(w_ * h_ + 1, 0);
+
+  // Counts per cell, prefix sums, then each body lands at its cell's cursor.
+  for (usize i = 0; i < bodies.size(); ++i) {
+    const auto& b = bodies[i];
+    if (!b.handle) continue;
+    auto a = aabbOf(b.wCollider);
+    cells_[i] = static_cast<u32>(cellY(a.center.y) * w_ + cellX(a.center.x));
+    ++starts_[cells_[i] + 1];
+  }
+
+  for (usize c = 1; c < starts_.size(); ++c) starts_[c] += starts_[c - 1];
+  items_.resize(count);
+  cursors_.assign(starts_.begin(), starts_.end() - 1);
+
+  for (usize i = 0; i < bodies.size(); ++i) {
+    if (!bodies[i].handle) continue;
+    items_[cursors_[cells_[i]]++] = static_cast<u32>(i);
+  }
+}
+}  // namespace rl
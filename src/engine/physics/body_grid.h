@@ -0,0 +1,77 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ENGINE_PHYSICS_BODY_GRID_H_
+#define ENGINE_PHYSICS_BODY_GRID_H_
+
+#include "engine/common.h"
+#include "engine/physics/collider.h"
+#include "engine/physics/physics_body.h"
+
+namespace rl {
+// Uniform grid over body centers, rebuilt from scratch with a counting sort:
+// one flat array of body indices, sorted by cell.
+class BodyGrid {
+ public:
+  void build(std::span<const PhysicsBody> bodies);
+
+  // Calls fn with the index of every body that may overlap a: the cells
+  // covering it, grown by the largest body half extent.
+  template <typename Fn>
+  void query(const Aabb& a, Fn&& fn) const {
+    if (items_.empty()) return;
+    auto x0 = cellX(a.center.x - a.halfExtents.x - reach_);
+    auto y0 = cellY(a.center.y - a.halfExtents.y - reach_);
+    auto x1 = cellX(a.center.x + a.halfExtents.x + reach_);
+    auto y1 = cellY(a.center.y + a.halfExtents.y + reach_);
+
+    for (auto y = y0; y <= y1; ++y) {
+      auto row = y * w_;
+
+      for (auto i = starts_[row + x0]; i < starts_[row + x1 + 1]; ++i) {
+        fn(items_[i]);
+      }
+    }
+  }
+
+  [[nodiscard]] usize size() const noexcept { return items_.size(); }
+
+ private:
+  inline static constexpr Distance kMinCellSize_ = 32.0f;
+  // Spread out bodies grow the cells rather than the grid.
+  inline static constexpr usize kMaxCellsPerBody_ = 4;
+
+  Position origin_{Position::zero()};
+  Distance cellSize_{kMinCellSize_};
+  Distance reach_{.0f};
+  usize w_{0};
+  usize h_{0};
+  std::vector<u32> starts_{};  // Per cell, then one past the last.
+  std::vector<u32> items_{};
+  std::vector<u32> cells_{};  // Per body index.
+  std::vector<u32> cursors_{};
+
+  usize cellX(Distance x) const { return cellOf(x - origin_.x, w_); }
+  usize cellY(Distance y) const { return cellOf(y - origin_.y, h_); }
+
+  usize cellOf(Distance d, usize count) const {
+    auto c = std::floor(d / cellSize_);
+    if (c <= .0f) return 0;
+    return std::min(static_cast<usize>(c), count - 1);
+  }
+};
+}  // namespace rl
+
+#endif  // ENGINE_PHYSICS_BODY_GRID_H_
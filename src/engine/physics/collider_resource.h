@@ -30,6 +30,7 @@ struct AnimColliderProfileResource {
 
   AnimColliderProfileId id{kInvalidResourceId};
   std::vector<AnimColliderSet> perAnim{};
+  std::vector<AnimColliderFrames> flatPerAnim{};  // Built at load time.
 };
 }  // namespace rl
 
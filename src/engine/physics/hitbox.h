@@ -26,6 +26,9 @@ using HitboxHandle = Handle<HitboxTag>;
 
 struct HitboxDesc {
   bool active{false};
+  // Swept from where it was last tick, so it hits what it passed through on
+  // the way: projectiles, boxes carried by dashes.
+  bool fast{false};
   CollisionFilter filter{};
   CollisionHitCount maxHitCount{kInvalidCollisionHitCount};
   Collider collider{};
@@ -39,6 +42,7 @@ enum HitboxFlagBits : HitboxFlags {
   kHitboxFlagBitsNone = 0x0,
   kHitboxFlagBitsActive = 0x1,
   kHitboxFlagBitsConsumed = 0x2,
+  kHitboxFlagBitsFast = 0x4,
   kHitboxFlagBitsAll = static_cast<HitboxFlags>(-1),
 };
 
@@ -53,6 +57,9 @@ struct Hitbox {
   CollisionHitCount maxHitCount{kInvalidCollisionHitCount};
   Collider collider{};
   Collider wCollider{};
+  // Fast boxes only, as of last tick: the local collider and where ref was.
+  Collider lastCollider{};
+  Position lastPos{Position::zero()};
   f64 endTime{.0};
   SpatialRef ref{};
 
@@ -68,6 +75,7 @@ struct Hitbox {
   bool active() const noexcept { return (flags & kHitboxFlagBitsActive); }
   void consume() { flags |= kHitboxFlagBitsConsumed; }
   bool consumed() const noexcept { return (flags & kHitboxFlagBitsConsumed); }
+  bool fast() const noexcept { return (flags & kHitboxFlagBitsFast); }
   bool flat() const noexcept { return collider.flat(); }
 
   bool done(f64 time) const {
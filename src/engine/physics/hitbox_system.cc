@@ -24,13 +24,53 @@
 #include "engine/core/log.h"
 #include "engine/core/param_traversal.h"
 #include "engine/core/vector.h"
+#include "engine/physics/physics_system.h"
 #include "engine/physics/physics_utils.h"
+#include "engine/transform/transform_system.h"
 
 #ifdef RL_DEBUG
 #include "engine/render/render_gizmo.h"
 #endif  // RL_DEBUG
 
 namespace rl {
+namespace internal {
+bool refPos(const SpatialRef& ref, Position& out) {
+  switch (ref.type) {
+    case SpatialRefType::Transform: {
+      const auto* t = RL_CTRANSSYS.global(ref.trans);
+      if (!t) return false;
+      out = t->pos;
+      return true;
+    }
+
+    case SpatialRefType::Position:
+      out = ref.pos;
+      return true;
+
+    case SpatialRefType::None:
+    default:
+      return false;
+  }
+}
+
+bool sameCollider(const Collider& a, const Collider& b) {
+  if (a.shape != b.shape) return false;
+
+  switch (a.shape) {
+    using enum ColliderShape;
+    case Aabb:
+      return almostZero(a.bounds.aabb.center - b.bounds.aabb.center) &&
+             almostZero(a.bounds.aabb.halfExtents - b.bounds.aabb.halfExtents);
+    case Circle:
+      return almostZero(a.bounds.circle.center - b.bounds.circle.center) &&
+             almostZero(a.bounds.circle.radius - b.bounds.circle.radius);
+    case Unknown:
+    default:
+      return false;
+  }
+}
+}  // namespace internal
+
 HitboxSystem& HitboxSystem::instance() {
   static HitboxSystem inst;
   return inst;
@@ -68,6 +108,22 @@ void HitboxSystem::shutdown() {
   grid_.clear();
 }
 
+void HitboxSystem::save(SnapshotWriter& w) const {
+  w.write(seenStamp_);
+  hHitboxPool_.save(w);
+  w.write(hitboxes_);
+  hHurtboxPool_.save(w);
+  w.write(hurtboxes_);
+  w.write(contacts_);
+}
+
+bool HitboxSystem::restore(SnapshotReader& r) {
+  // Case: the broad-phase grid is rebuilt every tick.
+  return r.read(seenStamp_) && hHitboxPool_.restore(r) &&
+         r.read(hitboxes_) && hHurtboxPool_.restore(r) &&
+         r.read(hurtboxes_) && r.read(contacts_);
+}
+
 void HitboxSystem::tick(const FramePacket& f) {
   contacts_.clear();
   grid_.clear();
@@ -80,9 +136,23 @@ void HitboxSystem::tick(const FramePacket& f) {
   }
 
   for (auto& hit : hitboxes_) {
-    if (!hit.active()) continue;
+    if (!hit.active()) {
+      // Case: sweeps start over from wherever it is once active again.
+      if (hit.fast()) hit.lastCollider = {};
+      continue;
+    }
+
     rebuildWorldCollider(hit);
     if (hit.collider.flat()) continue;
+    Dir d{Dir::zero()};
+
+    if (hit.fast() && sweepMove(hit, d)) {
+      auto from = hit.wCollider;
+      moveCollider(from, d * -1.0f);
+      sweepHit(hit, from, f.time);
+      continue;
+    }
+
     prepareSeenStamp();
     const auto& collider = aabbOf(hit.wCollider);
 
@@ -96,14 +166,7 @@ void HitboxSystem::tick(const FramePacket& f) {
         for (const auto& handle : cell.hurtboxes) {
           // Broad phase.
           auto* hurt = hurtbox(handle);
-
-          // Deduplicate.
-          if (hurt->seenStamp == seenStamp_) continue;
-          hurt->seenStamp = seenStamp_;
-
-          if (!hurt->active) continue;
-          if (!shouldCollide(hit.filter, hurt->filter)) continue;
-          if (hit.ref.sameTrans(hurt->ref)) continue;
+          if (!candidate(hit, *hurt)) continue;
 
           // Narrow phase.
           if (!overlap(hit.wCollider, hurt->wCollider)) continue;
@@ -111,12 +174,7 @@ void HitboxSystem::tick(const FramePacket& f) {
           if (alreadyHit) continue;
 
           // Event phase.
-          handleHit(hit, hurt, f.time);
-
-          if (!noHitCount(hit.maxHitCount) &&
-              ++hit.hitCount == hit.maxHitCount) {
-            hit.consume();
-          }
+          handleHit(hit, hit.wCollider, hurt, f.time);
         }
       }
     }
@@ -145,6 +203,7 @@ HitboxHandle HitboxSystem::generate(const HitboxDesc& desc) {
   };
 
   if (desc.active) hit.activate();
+  if (desc.fast) hit.flags |= kHitboxFlagBitsFast;
   return h;
 }
 
@@ -237,8 +296,81 @@ void HitboxSystem::rebuildWorldCollider(Hurtbox& h) {
   updateWorldCollider(h.collider, h.ref, h.wCollider);
 }
 
-void HitboxSystem::handleHit(Hitbox& hit, const Hurtbox* hurt, f64 time) {
-  auto p = contactPoint(hit.wCollider, hurt->wCollider);
+bool HitboxSystem::candidate(const Hitbox& hit, Hurtbox& hurt) const {
+  // Deduplicate.
+  if (hurt.seenStamp == seenStamp_) return false;
+  hurt.seenStamp = seenStamp_;
+
+  if (!hurt.active) return false;
+  if (!shouldCollide(hit.filter, hurt.filter)) return false;
+  return !hit.ref.sameTrans(hurt.ref);
+}
+
+bool HitboxSystem::sweepMove(Hitbox& hit, Dir& d) const {
+  Position pos{};
+  auto known = internal::refPos(hit.ref, pos);
+
+  // Case: a collider picked anew (e.g. on turning around) did not move from
+  // the last one, so only the owner's own motion is swept.
+  auto swept = known && !hit.lastCollider.flat() &&
+               internal::sameCollider(hit.collider, hit.lastCollider);
+  d = pos - hit.lastPos;
+  hit.lastCollider = known ? hit.collider : Collider{};
+  hit.lastPos = pos;
+  return swept && !almostZero(d);
+}
+
+void HitboxSystem::sweepHit(Hitbox& hit, const Collider& from, f64 time) {
+  auto d = aabbOf(hit.wCollider).center - aabbOf(from).center;
+
+  // Case: a wall stops the box, and hides what is behind it.
+  SweepHit wall{};
+  auto walled = (hit.filter.mask & kCollisionFlagBitsWorld) &&
+                RL_CPHYSICSSYS.sweepStatic(from, d, wall);
+
+  prepareSeenStamp();
+  sweptHurts_.clear();
+
+  usize x0, y0, x1, y1;
+  grid_.coveredCells(sweptAabb(from, d), x0, y0, x1, y1);
+
+  for (usize cy = y0; cy <= y1; ++cy) {
+    for (usize cx = x0; cx <= x1; ++cx) {
+      for (const auto& handle : grid_.at(cx, cy).hurtboxes) {
+        auto* hurt = hurtbox(handle);
+        if (!candidate(hit, *hurt)) continue;
+        SweepHit h{.t = .0f};
+
+        if (!overlap(from, hurt->wCollider) &&
+            !sweep(from, d, hurt->wCollider, h)) {
+          continue;
+        }
+
+        if (walled && h.t > wall.t) continue;
+        sweptHurts_.push_back({h.t, hurt->handle});
+      }
+    }
+  }
+
+  // In the order the box went through them.
+  std::sort(sweptHurts_.begin(), sweptHurts_.end(),
+            [](const SweptHurt& a, const SweptHurt& b) {
+              return a.t < b.t || (a.t == b.t && a.hurt.index < b.hurt.index);
+            });
+
+  for (const auto& s : sweptHurts_) {
+    if (hit.consumed()) break;
+    auto at = from;
+    moveCollider(at, d * s.t);
+    handleHit(hit, at, hurtbox(s.hurt), time);
+  }
+
+  if (walled) hit.consume();
+}
+
+void HitboxSystem::handleHit(Hitbox& hit, const Collider& at,
+                             const Hurtbox* hurt, f64 time) {
+  auto p = contactPoint(at, hurt->wCollider);
 
   contacts_.push_back(HitContact{
       .hit = hit.handle,
@@ -250,6 +382,10 @@ void HitboxSystem::handleHit(Hitbox& hit, const Hurtbox* hurt, f64 time) {
       .hurtFilter = hurt->filter,
       .time = time,
   });
+
+  if (!noHitCount(hit.maxHitCount) && ++hit.hitCount == hit.maxHitCount) {
+    hit.consume();
+  }
 }
 
 void HitboxSystem::cleanupHitboxes(f64 time) {
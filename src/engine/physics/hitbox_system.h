@@ -21,6 +21,7 @@
 #include "engine/core/handle.h"
 #include "engine/physics/grid.h"
 #include "engine/physics/hitbox.h"
+#include "engine/snapshot/snapshot.h"
 
 #ifdef RL_DEBUG
 #include "engine/core/color.h"
@@ -43,6 +44,9 @@ class HitboxSystem {
   void init();
   void shutdown();
 
+  void save(SnapshotWriter& w) const;
+  bool restore(SnapshotReader& r);
+
   void tick(const FramePacket& f);
 
   [[nodiscard]] HitboxHandle generate(const HitboxDesc& desc);
@@ -86,12 +90,23 @@ class HitboxSystem {
 
   std::vector<HitContact> contacts_{};
 
+  struct SweptHurt {
+    f32 t{.0f};
+    HurtboxHandle hurt{kInvalidHandle};
+  };
+
+  std::vector<SweptHurt> sweptHurts_{};
+
   HitboxSystem() = default;
 
   void prepareSeenStamp();
   void rebuildWorldCollider(Hitbox& h);
   void rebuildWorldCollider(Hurtbox& h);
-  void handleHit(Hitbox& hit, const Hurtbox* hurt, f64 time);
+  bool candidate(const Hitbox& hit, Hurtbox& hurt) const;
+  bool sweepMove(Hitbox& hit, Dir& d) const;
+  void sweepHit(Hitbox& hit, const Collider& from, f64 time);
+  void handleHit(Hitbox& hit, const Collider& at, const Hurtbox* hurt,
+                 f64 time);
   void cleanupHitboxes(f64 time);
 
 #ifdef RL_DEBUG
@@ -26,6 +26,12 @@
 namespace rl {
 struct PhysicsBodyDesc {
   bool dynamic{false};
+  // Steers around other bodies on its own: crowds of monsters, not players.
+  bool avoid{false};
+  // Swept against bodies and walls instead of moved in one jump, so it does
+  // not go through them at high speed: projectiles. Dashes and knockbacks
+  // are swept on any body.
+  bool fast{false};
 
   Velocity initVel{};
   Velocity maxVel{100.0f, 100.0f};
@@ -56,6 +62,10 @@ struct PhysicsBody {
   Dir dir{};
   CardinalDir cardDir{};
   Steering steer{};
+  bool avoid{false};
+  // Added to steer when moving, from the neighbors at the end of last tick.
+  Steering avoidance{};
+  bool fast{false};
 
   Velocity extVel{Velocity::zero()};
   Velocity extDec{60.0f, 60.0f};
@@ -25,9 +25,13 @@
 #include "engine/core/phase_bus.h"
 #include "engine/core/vector.h"
 #include "engine/event/event_system.h"
+#include "engine/input/input_replay_system.h"
+#include "engine/net/rollback_system.h"
 #include "engine/physics/anim_collider_sync_system.h"
 #include "engine/physics/hitbox_system.h"
+#include "engine/physics/physics_message.h"
 #include "engine/physics/physics_utils.h"
+#include "engine/relevance/relevance_system.h"
 #include "engine/sound/sound_system.h"
 #include "engine/transform/transform_system.h"
 
@@ -36,6 +40,41 @@
 #endif  // RL_DEBUG
 
 namespace rl {
+namespace internal {
+// Push out of wall along one axis only: x if alongY is false.
+Dir axisOut(const Aabb& a, const Aabb& wall, bool alongY) {
+  auto ea = extentsOf(a);
+  auto ew = extentsOf(wall);
+
+  if (alongY) {
+    auto up = a.center.y >= wall.center.y;
+    return {.0f, up ? ew.maxY - ea.minY : ew.minY - ea.maxY};
+  }
+
+  auto right = a.center.x >= wall.center.x;
+  return {right ? ew.maxX - ea.minX : ew.minX - ea.maxX, .0f};
+}
+
+// Whether pushing c out of r along out's main axis lands in another solid
+// cell, next to the row or column of c's center.
+bool buried(const StaticGrid& g, const StaticRect& r, const Collider& c,
+            Dir out) {
+  u16 cx, cy, cx1, cy1;
+  auto center = aabbOf(c).center;
+  if (!g.cellsOf({center, {.0f, .0f}}, cx, cy, cx1, cy1)) return false;
+
+  if (std::abs(out.x) >= std::abs(out.y)) {
+    if (out.x < .0f && r.x0 == 0) return false;
+    auto x = out.x > .0f ? r.x1 : static_cast<u16>(r.x0 - 1);
+    return g.solid(x, std::clamp<u16>(cy, r.y0, r.y1 - 1));
+  }
+
+  if (out.y < .0f && r.y0 == 0) return false;
+  auto y = out.y > .0f ? r.y1 : static_cast<u16>(r.y0 - 1);
+  return g.solid(std::clamp<u16>(cx, r.x0, r.x1 - 1), y);
+}
+}  // namespace internal
+
 PhysicsSystem& PhysicsSystem::instance() {
   static PhysicsSystem inst;
   return inst;
@@ -47,35 +86,102 @@ void PhysicsSystem::init() {
   hBodyPool_.clear();
   hBodyPool_.reserve(kDefaultBodyCap);
   bodies_.reserve(kDefaultBodyCap);
+  hStaticPool_.clear();
+  statics_.clear();
+  contacts_.clear();
+  contactStats_ = {};
+  governor_.reset();
+  catchUp_ = false;
 }
 
 void PhysicsSystem::shutdown() {
   RL_LOG_DEBUG("PhysicsSystem::shutdown");
   hBodyPool_.clear();
   bodies_.clear();
+  hStaticPool_.clear();
+  statics_.clear();
+
+  if (contactStats_.resolved + contactStats_.skipped > 0) {
+    RL_LOG_INFO("PhysicsSystem: ", contactStats_.resolved,
+                " contacts resolved, ", contactStats_.skipped, " resting.");
+  }
+
+  if (const auto& g = governor_.stats(); g.overBudgetFrames > 0) {
+    RL_LOG_INFO("PhysicsSystem: ", g.overBudgetFrames,
+                " frames over budget, ", g.escalations, " escalations, ",
+                g.droppedLag, "s dropped.");
+  }
+
+  contacts_.clear();
+}
+
+void PhysicsSystem::save(SnapshotWriter& w) const {
+  hBodyPool_.save(w);
+  w.write(bodies_);
+  w.write(contacts_);
+}
+
+bool PhysicsSystem::restore(SnapshotReader& r) {
+  return hBodyPool_.restore(r) && r.read(bodies_) && r.read(contacts_);
 }
 
 void PhysicsSystem::update(FramePacket& f) {
   lag_ += f.delta;
+  governor_.deterministic(RL_CINPUTREPLAY.recording() ||
+                          RL_CINPUTREPLAY.replaying() ||
+                          RL_CROLLBACK.active());
+  RL_RELEVSYS.degrade(governor_.dropsLod());
 
-  constexpr u32 kMaxStepCount = 5;
+  auto allowedCount = governor_.allowedStepCount();
+  auto skipping = governor_.skipsPhases();
   u32 stepCount = 0;
 
-  while (lag_ >= f.step && stepCount < kMaxStepCount) {
-    tick(f);
-    RL_ANIMSYS.tick(f);
-    RL_ANIMCOLSYNCSYS.tick(f);
-    RL_HITBOXSYS.tick(f);
-    RL_EVENTSYS.tick();
-    RL_SOUNDSYS.tick(f);
+  while (lag_ >= f.step && stepCount < allowedCount) {
+    catchUp_ = skipping && stepCount + 1 < allowedCount && lag_ >= 2 * f.step;
+    RL_PHASEBUS.config().skipOptional = catchUp_;
+    auto start = std::chrono::steady_clock::now();
+    RL_INPUTREPLAY.tick();
+    // Case: a stalled rollback session waits for remote input instead.
+    if (RL_ROLLBACK.tick(f)) step(f);
+    governor_.measure(std::chrono::duration<f64>(
+                          std::chrono::steady_clock::now() - start)
+                          .count());
     lag_ -= f.step;
     ++stepCount;
   }
 
+  catchUp_ = false;
+  RL_PHASEBUS.config().skipOptional = false;
+  lag_ = governor_.settle(lag_, f.delta, f.step, stepCount);
+  if (governor_.changed()) applyGovernor();
+
   f.lag = lag_;
+  f.stepCount = stepCount;
+  f.dilation = governor_.stats().dilation;
   RL_PHYSICS_DEBUG_UPDATE(f);
 }
 
+void PhysicsSystem::step(const FramePacket& f) {
+  RL_RELEVSYS.tick(f);
+  tick(f);
+  RL_ANIMSYS.tick(f);
+  RL_ANIMCOLSYNCSYS.tick(f);
+  RL_HITBOXSYS.tick(f);
+  RL_EVENTSYS.tick();
+  // Case: listener gains only need to be right on the step before rendering.
+  if (!catchUp_) RL_SOUNDSYS.tick(f);
+}
+
+void PhysicsSystem::applyGovernor() {
+  const auto& g = governor_.stats();
+  RL_LOG_DEBUG("PhysicsSystem: Step governor at level ",
+               static_cast<u32>(g.level), ", ", g.allowedStepCount,
+               " steps allowed per frame.");
+  RL_EVENTSYS.dispatch(kPhysicsMessageIdStepGovernor, g.level,
+                       g.allowedStepCount, g.stepCount,
+                       static_cast<f32>(g.dilation));
+}
+
 PhysicsBodyHandle PhysicsSystem::generate(PhysicsBodyDesc desc) {
   auto h = hBodyPool_.generate();
   ensureCapacity(bodies_, h.index);
@@ -89,6 +195,8 @@ PhysicsBodyHandle PhysicsSystem::generate(PhysicsBodyDesc desc) {
   b.acc = desc.acc;
 
   b.dynamic = desc.dynamic;
+  b.avoid = desc.avoid;
+  b.fast = desc.fast;
   b.collider = desc.collider;
   return h;
 }
@@ -169,6 +277,50 @@ void PhysicsSystem::dash(PhysicsBodyHandle h, Dir dir, f32 speed,
   b->extDec = {dec, dec};
 }
 
+StaticGridHandle PhysicsSystem::generateStaticGrid(const StaticGridDesc& desc) {
+  auto h = hStaticPool_.generate();
+  ensureCapacity(statics_, h.index);
+  statics_[h.index].init(desc);
+  return h;
+}
+
+void PhysicsSystem::destroyStaticGrid(StaticGridHandle h) {
+  RL_ASSERT(h && hStaticPool_.alive(h),
+            "PhysicsSystem::destroyStaticGrid: Invalid static grid handle "
+            "provided!");
+  if (!h || !hStaticPool_.alive(h)) return;
+  statics_[h.index].clear();
+  hStaticPool_.destroy(h);
+}
+
+void PhysicsSystem::solid(StaticGridHandle h, u16 x, u16 y, bool isSolid) {
+  RL_ASSERT(h && hStaticPool_.alive(h),
+            "PhysicsSystem::solid: Invalid static grid handle provided!");
+  if (!h || !hStaticPool_.alive(h)) return;
+  statics_[h.index].solid(x, y, isSolid);
+}
+
+bool PhysicsSystem::sweepStatic(const Collider& c, Dir d, SweepHit& hit) const {
+  auto area = sweptAabb(c, d);
+  auto any = false;
+
+  for (const auto& g : statics_) {
+    u16 x0, y0, x1, y1;
+    if (g.empty() || !g.cellsOf(area, x0, y0, x1, y1)) continue;
+
+    g.rects(x0, y0, x1, y1, [&](const StaticRect& r) {
+      Collider wall{.shape = ColliderShape::Aabb,
+                    .bounds = {.aabb = g.aabbOf(r)}};
+      SweepHit h{};
+      if (!rl::sweep(c, d, wall, h) || h.t >= hit.t) return;
+      hit = h;
+      any = true;
+    });
+  }
+
+  return any;
+}
+
 const PhysicsBody* PhysicsSystem::body(PhysicsBodyHandle h) const {
   RL_ASSERT(h && hBodyPool_.alive(h),
             "PhysicsSystem::body: Invalid physics body handle provided!");
@@ -197,9 +349,18 @@ void PhysicsSystem::updateDebug() const {
 void PhysicsSystem::tick(const FramePacket& f) {
   auto dt = static_cast<f32>(f.step);
 
+  for (auto& g : statics_) g.rebuild();
+
+  for (auto& b : bodies_) applyAcceleration(b, dt);
+  warmStartContacts();
+
   for (auto& b : bodies_) {
-    applyAcceleration(b, dt);
-    applyVelocity(b, dt);
+    if (b.dynamic && (b.fast || !almostZero(b.extVel))) {
+      sweep(b, dt);
+    } else {
+      applyVelocity(b, dt);
+    }
+
     applyDirection(b);
   }
 
@@ -209,37 +370,265 @@ void PhysicsSystem::tick(const FramePacket& f) {
     applyTransform(b);
   }
 
+  grid_.build(bodies_);
   resolveBodiesVsBodies();
+  resolveBodiesVsStatic();
   RL_PHASEBUS.invoke(TickPhase::FixedUpdate, f);
+  avoid();
   RL_PHYSICS_DEBUG_TICK();
 }
 
+void PhysicsSystem::sweep(PhysicsBody& b, f32 dt) {
+  auto* t = RL_TRANSSYS.local(b.trans);
+  const auto* g = RL_CTRANSSYS.global(b.trans);
+  if (!t || !g) return;
+
+  // Against the bodies as the grid last saw them. Pushes since the transform
+  // tick only moved the local position.
+  Collider c{};
+  updateWorldCollider(b.collider, b.trans, c);
+  moveCollider(c, t->pos - g->pos);
+  auto d = (b.vel + b.extVel) * dt;
+  Dir moved{Dir::zero()};
+
+  for (u32 i = 0; i < kMaxSweepCount_ && !almostZero(d); ++i) {
+    SweepHit hit{};
+    auto any = sweepStatic(c, d, hit);
+
+    grid_.query(sweptAabb(c, d), [&](u32 j) {
+      const auto& o = bodies_[j];
+      SweepHit h{};
+      if (!o.handle || o.handle == b.handle) return;
+      if (!rl::sweep(c, d, o.wCollider, h) || h.t >= hit.t) return;
+      hit = h;
+      any = true;
+    });
+
+    if (!any) {
+      moved += d;
+      break;
+    }
+
+    auto step = d * std::max(.0f, hit.t - kSweepSkin_ / d.mag());
+    moveCollider(c, step);
+    moved += step;
+
+    // The rest slides along what was hit, without what goes into it.
+    const auto& n = hit.normal;
+    auto rest = d - step;
+    d = rest - n * std::min(.0f, rest.x * n.x + rest.y * n.y);
+    b.vel -= n * std::min(.0f, b.vel.x * n.x + b.vel.y * n.y);
+    b.extVel -= n * std::min(.0f, b.extVel.x * n.x + b.extVel.y * n.y);
+  }
+
+  t->pos += moved;
+  t->dirty = true;
+}
+
 void PhysicsSystem::resolveBodiesVsBodies() {
   auto bodyCount = bodies_.size();
+  nextContacts_.clear();
+  usize cached = 0;
 
   for (usize i = 0; i < bodyCount; ++i) {
     auto& a = bodies_[i];
     if (!a.handle) continue;
 
-    for (usize j = i + 1; j < bodyCount; ++j) {
+    // Broad phase: only the bodies in the grid cells around a. Sorting keeps
+    // the pairs in the order a full sweep would resolve them.
+    candidates_.clear();
+
+    grid_.query(aabbOf(a.wCollider), [&](u32 j) {
+      if (j > i) candidates_.push_back(j);
+    });
+
+    std::sort(candidates_.begin(), candidates_.end());
+
+    for (auto j : candidates_) {
       auto& b = bodies_[j];
       if (!b.handle) continue;
 
       const auto& ca = a.wCollider;
       const auto& cb = b.wCollider;
 
-      // Broad phase: quick bounding-volume test to skip non-overlapping pairs.
+      // Quick bounding-volume test to skip non-overlapping pairs.
       if (!overlap(ca, cb)) continue;
 
+      // Last tick's contact of the pair, if any: pairs come in the order
+      // they were stored.
+      while (cached < contacts_.size() &&
+             (contacts_[cached].a.index < i ||
+              (contacts_[cached].a.index == i &&
+               contacts_[cached].b.index < j))) {
+        ++cached;
+      }
+
+      const Contact* c = nullptr;
+
+      if (cached < contacts_.size() && contacts_[cached].a == a.handle &&
+          contacts_[cached].b == b.handle) {
+        c = &contacts_[cached];
+      }
+
+      auto offset = aabbOf(cb).center - aabbOf(ca).center;
+
+      // Case: resting, as the last push left it. Nothing to redo.
+      if (c && (offset - c->offset).magSqrd() <
+                   kRestingMotion_ * kRestingMotion_) {
+        nextContacts_.push_back(*c);
+        ++contactStats_.skipped;
+        continue;
+      }
+
       // Narrow phase: compute precise collision info (minimum translation
       // vector).
       Dir mtv{};
       if (!rl::mtv(ca, cb, mtv)) continue;
+      ++contactStats_.resolved;
+
+      // Case: centers on top of each other. The last side pushed to holds.
+      if (c && almostZero(offset.magSqrd())) mtv = c->axis * mtv.mag();
 
       // Collision response: separate bodies using the MTV.
       applyMtv(a, b, mtv);
+      auto moved = a.dynamic || b.dynamic;
+
+      nextContacts_.push_back({
+          .a = a.handle,
+          .b = b.handle,
+          .axis = mtv.normalized(),
+          .offset = moved ? offset + mtv : offset,
+      });
     }
   }
+
+  contacts_.swap(nextContacts_);
+}
+
+void PhysicsSystem::warmStartContacts() {
+  for (const auto& c : contacts_) {
+    auto& a = bodies_[c.a.index];
+    auto& b = bodies_[c.b.index];
+    if (a.handle != c.a || b.handle != c.b) continue;
+
+    // Case: closing in along the contact. That part of the velocity would
+    // only overlap the pair again and get pushed back out, so each body gives
+    // up its share of it: none is pushed, so pressed crowds come to rest.
+    const auto& n = c.axis;
+    auto va = a.vel.x * n.x + a.vel.y * n.y;
+    auto vb = b.vel.x * n.x + b.vel.y * n.y;
+    auto closing = va - vb;
+    if (closing <= .0f) continue;
+    auto ia = a.dynamic ? std::max(va, .0f) : .0f;
+    auto ib = b.dynamic ? std::max(-vb, .0f) : .0f;
+    auto into = ia + ib;
+    if (into <= .0f) continue;
+    a.vel -= n * (closing * ia / into);
+    b.vel += n * (closing * ib / into);
+  }
+}
+
+void PhysicsSystem::resolveBodiesVsStatic() {
+  auto any = std::any_of(statics_.begin(), statics_.end(),
+                         [](const auto& g) { return !g.empty(); });
+  if (!any) return;
+
+  for (auto& b : bodies_) {
+    if (!b.handle || !b.dynamic) continue;
+    auto* t = RL_TRANSSYS.local(b.trans);
+    const auto* g = RL_CTRANSSYS.global(b.trans);
+    if (!t || !g) continue;
+
+    // Pushes from other bodies only moved the local position so far.
+    auto c = b.wCollider;
+    moveCollider(c, t->pos - g->pos);
+    Dir push{Dir::zero()};
+
+    for (const auto& grid : statics_) {
+      if (!grid.empty()) resolveBodyVsStatic(b, grid, c, push);
+    }
+
+    if (almostZero(push)) continue;
+    t->pos += push;
+    t->dirty = true;
+    moveCollider(b.wCollider, push);
+  }
+}
+
+void PhysicsSystem::resolveBodyVsStatic(PhysicsBody& b, const StaticGrid& g,
+                                        Collider& c, Dir& push) {
+  u16 x0, y0, x1, y1;
+  // Only the few cells under the body: nothing more when they are all open.
+  if (!g.cellsOf(aabbOf(c), x0, y0, x1, y1)) return;
+  if (!g.anySolid(x0, y0, x1, y1)) return;
+
+  g.rects(x0, y0, x1, y1, [&](const StaticRect& r) {
+    auto wall = g.aabbOf(r);
+    Dir m{};
+    if (!mtv(c, {.shape = ColliderShape::Aabb, .bounds = {.aabb = wall}}, m)) {
+      return;
+    }
+
+    // Case: pushed through a side another solid cell touches, which snags
+    // bodies sliding along a wall made of several rectangles. The other axis
+    // goes out of the wall instead, unless it is just as buried.
+    Dir out = -m;
+    if (internal::buried(g, r, c, out)) {
+      auto a = aabbOf(c);
+      auto alt = internal::axisOut(a, wall, std::abs(out.x) >= std::abs(out.y));
+      if (!internal::buried(g, r, c, alt)) out = alt;
+    }
+
+    moveCollider(c, out);
+    push += out;
+
+    // Whatever moved into the wall stops on that axis.
+    if (out.x * b.vel.x < .0f) b.vel.x = .0f;
+    if (out.y * b.vel.y < .0f) b.vel.y = .0f;
+    if (out.x * b.extVel.x < .0f) b.extVel.x = .0f;
+    if (out.y * b.extVel.y < .0f) b.extVel.y = .0f;
+  });
+}
+
+void PhysicsSystem::avoid() {
+  auto radiusOf = [](const Aabb& a) {
+    return std::max(a.halfExtents.x, a.halfExtents.y);
+  };
+
+  for (usize i = 0; i < bodies_.size(); ++i) {
+    auto& a = bodies_[i];
+    a.avoidance = Steering::zero();
+    if (!a.handle || !a.avoid || !a.dynamic || almostZero(a.steer)) continue;
+
+    auto aa = aabbOf(a.wCollider);
+    auto reach = radiusOf(aa) + kAvoidRange_;
+    auto dir = a.steer;
+    dir = dir.normalized();
+    Steering left{-dir.y, dir.x};
+
+    grid_.query({aa.center, {reach, reach}}, [&](u32 j) {
+      if (j == i || !bodies_[j].handle) return;
+      auto ab = aabbOf(bodies_[j].wCollider);
+      auto range = radiusOf(aa) + radiusOf(ab) + kAvoidRange_;
+      auto away = aa.center - ab.center;
+      auto dist2 = away.magSqrd();
+      if (dist2 >= range * range) return;
+
+      // Case: same center. The lower index gives way to the left, the other
+      // to the right, so the pair still splits up.
+      auto dist = std::sqrt(dist2);
+      auto n = dist > 1e-4f ? away / dist : left * (i < j ? 1.0f : -1.0f);
+      auto weight = 1.0f - dist / range;
+      a.avoidance += n * (weight * kSeparationWeight_);
+
+      // Neighbors ahead also push sideways, to the side they are not on.
+      auto ahead = -(n.x * dir.x + n.y * dir.y);
+      if (ahead <= .0f) return;
+      auto side = n.x * left.x + n.y * left.y;
+      auto sign = side > .0f || (side == .0f && i < j) ? 1.0f : -1.0f;
+      a.avoidance += left * (sign * weight * ahead * kAvoidanceWeight_);
+    });
+  }
 }
 
 #ifdef RL_DEBUG
@@ -20,8 +20,13 @@
 #include "engine/core/frame.h"
 #include "engine/core/handle.h"
 #include "engine/core/type.h"
+#include "engine/physics/body_grid.h"
 #include "engine/physics/physics.h"
 #include "engine/physics/physics_body.h"
+#include "engine/physics/physics_utils.h"
+#include "engine/physics/static_grid.h"
+#include "engine/physics/step_governor.h"
+#include "engine/snapshot/snapshot.h"
 #include "engine/transform/transform.h"
 
 #ifdef RL_DEBUG
@@ -39,6 +44,17 @@ enum PhysicsSystemDebugFlagBits : PhysicsSystemDebugFlags {
   kPhysicsSystemDebugFlagBitsAll = static_cast<PhysicsSystemDebugFlags>(-1),
 };
 
+struct BodyRayHit {
+  PhysicsBodyHandle body{kInvalidHandle};
+  f32 t{1.0f};  // Along the segment, from 0 to 1.
+  Position point{};
+};
+
+struct BodyContactStats {
+  u64 resolved{0};  // Pairs that went through the narrow phase.
+  u64 skipped{0};   // Resting pairs left as they were.
+};
+
 class PhysicsSystem {
  public:
   static PhysicsSystem& instance();
@@ -46,7 +62,12 @@ class PhysicsSystem {
   void init();
   void shutdown();
 
+  void save(SnapshotWriter& w) const;
+  bool restore(SnapshotReader& r);
+
   void update(FramePacket& f);
+  // One fixed tick of the simulation pipeline, without the accumulator.
+  void step(const FramePacket& f);
 
   [[nodiscard]] PhysicsBodyHandle generate(PhysicsBodyDesc desc);
   void destroy(PhysicsBodyHandle h);
@@ -61,6 +82,70 @@ class PhysicsSystem {
 
   const PhysicsBody* body(PhysicsBodyHandle h) const;
 
+  const BodyContactStats& contactStats() const noexcept {
+    return contactStats_;
+  }
+
+  StepGovernor& governor() noexcept { return governor_; }
+  const StepGovernor& governor() const noexcept { return governor_; }
+
+  // Static geometry that dynamic bodies are pushed out of every tick. It
+  // belongs to whoever generated it (tiles) and is not part of snapshots.
+  [[nodiscard]] StaticGridHandle generateStaticGrid(const StaticGridDesc& desc);
+  void destroyStaticGrid(StaticGridHandle h);
+  void solid(StaticGridHandle h, u16 x, u16 y, bool isSolid);
+  // Lowers hit to the first solid cell c runs into when moving by d.
+  bool sweepStatic(const Collider& c, Dir d, SweepHit& hit) const;
+
+  // Spatial queries go through the grid built this tick: bodies generated
+  // since are only found from the next one.
+  // Broad phase only: every live body that may overlap a.
+  template <typename Fn>
+  void candidates(const Aabb& a, Fn&& fn) const {
+    grid_.query(a, [&](u32 i) {
+      if (bodies_[i].handle) fn(bodies_[i]);
+    });
+  }
+
+  template <typename Fn>
+  void overlaps(const Collider& c, Fn&& fn) const {
+    candidates(aabbOf(c), [&](const PhysicsBody& b) {
+      if (overlap(b.wCollider, c)) fn(b.handle);
+    });
+  }
+
+  template <typename Fn>
+  void overlaps(const Circle& c, Fn&& fn) const {
+    overlaps(Collider{.shape = ColliderShape::Circle, .bounds = {.circle = c}},
+             fn);
+  }
+
+  template <typename Fn>
+  void overlaps(const Aabb& a, Fn&& fn) const {
+    overlaps(Collider{.shape = ColliderShape::Aabb, .bounds = {.aabb = a}}, fn);
+  }
+
+  // First body entered by the segment from -> to among those accept takes.
+  template <typename Fn>
+  bool raycast(Position from, Position to, BodyRayHit& hit,
+               Fn&& accept) const {
+    hit = {};
+    auto d = to - from;
+    Aabb area{from + d * .5f, {std::abs(d.x) * .5f, std::abs(d.y) * .5f}};
+
+    grid_.query(area, [&](u32 i) {
+      const auto& b = bodies_[i];
+      f32 t{.0f};
+      if (!b.handle || !segmentHit(b.wCollider, from, to, t)) return;
+      if (t > hit.t || (t == hit.t && hit.body) || !accept(b.handle)) return;
+      hit.body = b.handle;
+      hit.t = t;
+    });
+
+    hit.point = from + d * hit.t;
+    return static_cast<bool>(hit.body);
+  }
+
 #ifdef RL_DEBUG
   void debugOn(PhysicsSystemDebugFlags flags) { dFlags_ |= flags; }
   void debugOff(PhysicsSystemDebugFlags flags) { dFlags_ &= ~flags; }
@@ -75,14 +160,53 @@ class PhysicsSystem {
   PhysicsSystemDebugFlags dFlags_{kPhysicsSystemDebugFlagBitsNone};
 #endif  // RL_DEBUG
 
+  // How far beyond touching a neighbor starts to push a mover away.
+  inline static constexpr Distance kAvoidRange_ = 8.0f;
+  inline static constexpr f32 kSeparationWeight_ = 2.0f;
+  // Sideways push from neighbors ahead, to go around them.
+  inline static constexpr f32 kAvoidanceWeight_ = .6f;
+  // Below this, a pair in contact has not moved since it was separated.
+  inline static constexpr Distance kRestingMotion_ = .05f;
+  // Most surfaces a swept body slides along in one tick.
+  inline static constexpr u32 kMaxSweepCount_ = 3;
+  // Kept between a swept body and what it stops at, to start outside of it.
+  inline static constexpr Distance kSweepSkin_ = .01f;
+
   f64 lag_{.0};
+  StepGovernor governor_{};
+  bool catchUp_{false};  // Not the last step of an over budget frame.
   HandlePool<PhysicsBodyTag> hBodyPool_{};
   std::vector<PhysicsBody> bodies_;
+  BodyGrid grid_{};
+  std::vector<u32> candidates_{};
+
+  // A pair of bodies in contact, kept from one tick to the next.
+  struct Contact {
+    PhysicsBodyHandle a{kInvalidHandle};  // Lower index.
+    PhysicsBodyHandle b{kInvalidHandle};
+    Dir axis{Dir::zero()};    // Last push, from a to b, normalized.
+    Dir offset{Dir::zero()};  // Of b from a, once pushed apart.
+  };
+
+  // In pair order, which is the order resolution meets them in.
+  std::vector<Contact> contacts_{};
+  std::vector<Contact> nextContacts_{};
+  BodyContactStats contactStats_{};
+
+  HandlePool<StaticGridTag> hStaticPool_{};
+  std::vector<StaticGrid> statics_{};
 
   PhysicsSystem() = default;
 
   void tick(const FramePacket& f);
+  void applyGovernor();
+  void sweep(PhysicsBody& b, f32 dt);
+  void warmStartContacts();
   void resolveBodiesVsBodies();
+  void resolveBodiesVsStatic();
+  void resolveBodyVsStatic(PhysicsBody& b, const StaticGrid& g, Collider& c,
+                           Dir& push);
+  void avoid();
 
   PhysicsBody* body(PhysicsBodyHandle h);
 
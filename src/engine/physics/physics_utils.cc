@@ -66,7 +66,8 @@ void applyTransform(PhysicsBody& b) {
 
 void applyAcceleration(PhysicsBody& b, f32 dt) {
   if (!b.dynamic) return;
-  Vec2F32 targetVel = {b.steer.x * b.maxVel.x, b.steer.y * b.maxVel.y};
+  auto steer = (b.steer + b.avoidance).clampMag(1.0f);
+  Vec2F32 targetVel = {steer.x * b.maxVel.x, steer.y * b.maxVel.y};
 
   auto stopX = almostZero(targetVel.x);
   auto stopY = almostZero(targetVel.y);
@@ -235,6 +236,128 @@ void applyDirection(PhysicsBody& b) {
   };
 }
 
+[[nodiscard]] bool segmentHit(const Collider& c, Position from, Position to,
+                              f32& t) {
+  auto d = to - from;
+
+  switch (c.shape) {
+    using enum ColliderShape;
+
+    case Aabb: {
+      auto ex = extentsOf(c.bounds.aabb);
+      auto tMin = .0f;
+      auto tMax = 1.0f;
+
+      // Slabs: the segment is inside the box where it is inside both.
+      auto slab = [&](f32 p, f32 dp, f32 lo, f32 hi) {
+        if (almostZero(dp)) return p >= lo && p <= hi;
+        auto t0 = (lo - p) / dp;
+        auto t1 = (hi - p) / dp;
+        if (t0 > t1) std::swap(t0, t1);
+        tMin = std::max(tMin, t0);
+        tMax = std::min(tMax, t1);
+        return tMin <= tMax;
+      };
+
+      if (!slab(from.x, d.x, ex.minX, ex.maxX)) return false;
+      if (!slab(from.y, d.y, ex.minY, ex.maxY)) return false;
+      t = tMin;
+      return true;
+    }
+
+    case Circle: {
+      const auto& circle = c.bounds.circle;
+      auto m = from - circle.center;
+      auto rest = m.magSqrd() - circle.radius * circle.radius;
+
+      if (rest <= .0f) {
+        t = .0f;
+        return true;
+      }
+
+      auto a = d.magSqrd();
+      auto b = m.x * d.x + m.y * d.y;
+      if (b >= .0f || almostZero(a)) return false;
+      auto disc = b * b - a * rest;
+      if (disc < .0f) return false;
+      t = (-b - std::sqrt(disc)) / a;
+      return t <= 1.0f;
+    }
+
+    default:
+      return false;
+  }
+}
+
+[[nodiscard]] bool sweep(const Collider& c, Dir d, const Collider& target,
+                         SweepHit& hit) {
+  // Minkowski sum: the center of c as a segment against target grown by c.
+  Collider grown{};
+  Position from{};
+
+  if (c.shape == ColliderShape::Circle &&
+      target.shape == ColliderShape::Circle) {
+    from = c.bounds.circle.center;
+    grown = target;
+    grown.bounds.circle.radius += c.bounds.circle.radius;
+  } else {
+    auto a = aabbOf(c);
+    from = a.center;
+    grown.shape = ColliderShape::Aabb;
+    grown.bounds.aabb = aabbOf(target);
+    grown.bounds.aabb.halfExtents += a.halfExtents;
+  }
+
+  f32 t{.0f};
+  if (!segmentHit(grown, from, from + d, t)) return false;
+  auto p = from + d * t;
+  Dir normal{Dir::zero()};
+
+  if (grown.shape == ColliderShape::Circle) {
+    normal = (p - grown.bounds.circle.center).normalized();
+  } else {
+    // The face hit is the one p is the furthest out of, relative to the size.
+    const auto& box = grown.bounds.aabb;
+    auto off = p - box.center;
+    auto nx = std::abs(off.x) / avoidNegOrZero(box.halfExtents.x);
+    auto ny = std::abs(off.y) / avoidNegOrZero(box.halfExtents.y);
+
+    if (nx >= ny) {
+      normal = {off.x < .0f ? -1.0f : 1.0f, .0f};
+    } else {
+      normal = {.0f, off.y < .0f ? -1.0f : 1.0f};
+    }
+  }
+
+  // Case: starting flush with (or a hair inside) target. Moving into it is
+  // still a hit, or the whole move would go through; moving out is not.
+  if (t <= .0f && d.x * normal.x + d.y * normal.y >= .0f) return false;
+  hit.t = std::max(t, .0f);
+  hit.normal = normal;
+  return true;
+}
+
+[[nodiscard]] Aabb sweptAabb(const Collider& c, Dir d) {
+  auto a = aabbOf(c);
+  a.center += d * .5f;
+  a.halfExtents += {std::abs(d.x) * .5f, std::abs(d.y) * .5f};
+  return a;
+}
+
+void moveCollider(Collider& c, Dir d) {
+  switch (c.shape) {
+    using enum ColliderShape;
+    case Aabb:
+      c.bounds.aabb.center += d;
+      return;
+    case Circle:
+      c.bounds.circle.center += d;
+      return;
+    default:
+      return;
+  }
+}
+
 void updateWorldCollider(const Collider& collider, TransformHandle trans,
                          Collider& wCollider) {
   wCollider = {};
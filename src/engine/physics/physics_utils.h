@@ -82,6 +82,26 @@ template <Floating T>
 [[nodiscard]] bool overlap(const Collider& a, const Collider& b);
 
 [[nodiscard]] Position contactPoint(const Collider& a, const Collider& b);
+// Whether the segment from -> to enters c, with t the entry as a fraction of
+// the segment (0 if it starts inside).
+[[nodiscard]] bool segmentHit(const Collider& c, Position from, Position to,
+                              f32& t);
+
+struct SweepHit {
+  f32 t{1.0f};  // Along the motion, from 0 to 1.
+  Dir normal{Dir::zero()};  // Out of the surface hit.
+};
+
+// Whether c moving by d runs into target. Starting in contact, only moving
+// into target is a hit, at t = 0.
+// Boxes are grown by the other shape's box, so a circle against a box (or the
+// reverse) hits a bit early on the corners.
+[[nodiscard]] bool sweep(const Collider& c, Dir d, const Collider& target,
+                         SweepHit& hit);
+
+// What c covers on its way to c moved by d.
+[[nodiscard]] Aabb sweptAabb(const Collider& c, Dir d);
+void moveCollider(Collider& c, Dir d);
 
 void updateWorldCollider(const Collider& collider, TransformHandle trans,
                          Collider& wCollider);
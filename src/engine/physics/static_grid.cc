@@ -0,0 +1,171 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "static_grid.h"
+////////////////////////////////////////////////////////////////////////////////
+
+namespace rl {
+void StaticGrid::init(const StaticGridDesc& desc) {
+  origin_ = desc.origin;
+  cellSize_ = desc.cellSize;
+  w_ = desc.width;
+  h_ = desc.height;
+  chunkW_ = static_cast<u16>((w_ + kChunkSize_ - 1) / kChunkSize_);
+  chunkH_ = static_cast<u16>((h_ + kChunkSize_ - 1) / kChunkSize_);
+  solidCount_ = 0;
+  bits_.assign((static_cast<usize>(w_) * h_ + 63) / 64, 0);
+  chunks_.clear();
+  chunks_.resize(static_cast<usize>(chunkW_) * chunkH_);
+  dirty_.clear();
+  taken_.assign(kChunkSize_ * kChunkSize_, 0);
+}
+
+void StaticGrid::clear() {
+  w_ = h_ = chunkW_ = chunkH_ = 0;
+  solidCount_ = 0;
+  bits_.clear();
+  chunks_.clear();
+  dirty_.clear();
+}
+
+void StaticGrid::solid(u16 x, u16 y, bool isSolid) {
+  RL_ASSERT(x < w_ && y < h_, "StaticGrid::solid: Cell out of bounds!");
+  if (x >= w_ || y >= h_) return;
+  if (solid(x, y) == isSolid) return;
+  auto i = bit(x, y);
+  bits_[i / 64] ^= u64{1} << (i % 64);
+
+  if (isSolid) {
+    ++solidCount_;
+  } else {
+    --solidCount_;
+  }
+
+  auto chunk = static_cast<u32>(y / kChunkSize_) * chunkW_ + x / kChunkSize_;
+  auto& c = chunks_[chunk];
+  if (c.dirty) return;
+  c.dirty = true;
+  dirty_.push_back(chunk);
+}
+
+bool StaticGrid::solid(u16 x, u16 y) const {
+  if (x >= w_ || y >= h_) return false;
+  auto i = bit(x, y);
+  return (bits_[i / 64] >> (i % 64)) & 1;
+}
+
+void StaticGrid::rebuild() {
+  for (auto chunk : dirty_) {
+    merge(chunk);
+    chunks_[chunk].dirty = false;
+  }
+
+  dirty_.clear();
+}
+
+bool StaticGrid::cellsOf(const Aabb& a, u16& x0, u16& y0, u16& x1,
+                         u16& y1) const {
+  if (w_ == 0 || h_ == 0) return false;
+  auto min = (a.center - a.halfExtents - origin_) / cellSize_;
+  auto max = (a.center + a.halfExtents - origin_) / cellSize_;
+  if (max.x < .0f || max.y < .0f) return false;
+  if (min.x >= static_cast<f32>(w_) || min.y >= static_cast<f32>(h_)) {
+    return false;
+  }
+
+  auto clampTo = [](f32 v, u16 count) {
+    if (v <= .0f) return u16{0};
+    return static_cast<u16>(std::min(static_cast<u32>(v), count - 1u));
+  };
+
+  x0 = clampTo(min.x, w_);
+  y0 = clampTo(min.y, h_);
+  x1 = clampTo(max.x, w_);
+  y1 = clampTo(max.y, h_);
+  return true;
+}
+
+bool StaticGrid::anySolid(u16 x0, u16 y0, u16 x1, u16 y1) const {
+  for (auto y = y0; y <= y1; ++y) {
+    for (auto x = x0; x <= x1; ++x) {
+      if (solid(x, y)) return true;
+    }
+  }
+
+  return false;
+}
+
+Aabb StaticGrid::aabbOf(const StaticRect& r) const {
+  auto half = cellSize_ * .5f;
+  Position min{static_cast<Distance>(r.x0), static_cast<Distance>(r.y0)};
+  HalfExtents size{static_cast<Distance>(r.x1 - r.x0),
+                   static_cast<Distance>(r.y1 - r.y0)};
+  return {
+      .center = origin_ + min * cellSize_ + size * half,
+      .halfExtents = size * half,
+  };
+}
+
+void StaticGrid::merge(u32 chunk) {
+  auto& c = chunks_[chunk];
+  c.rects.clear();
+  auto ox = static_cast<u16>(chunk % chunkW_ * kChunkSize_);
+  auto oy = static_cast<u16>(chunk / chunkW_ * kChunkSize_);
+  auto cw = static_cast<u16>(std::min<u32>(kChunkSize_, w_ - ox));
+  auto ch = static_cast<u16>(std::min<u32>(kChunkSize_, h_ - oy));
+  std::fill(taken_.begin(), taken_.end(), 0);
+
+  auto free = [&](u16 x, u16 y) {
+    return !taken_[y * kChunkSize_ + x] && solid(ox + x, oy + y);
+  };
+
+  // Greedy: the widest run from the first free cell, then as many rows below
+  // as fit the same run.
+  for (u16 y = 0; y < ch; ++y) {
+    for (u16 x = 0; x < cw; ++x) {
+      if (!free(x, y)) continue;
+      auto x1 = static_cast<u16>(x + 1);
+      while (x1 < cw && free(x1, y)) ++x1;
+      auto y1 = static_cast<u16>(y + 1);
+
+      for (; y1 < ch; ++y1) {
+        auto full = true;
+
+        for (auto rx = x; rx < x1 && full; ++rx) {
+          full = free(rx, y1);
+        }
+
+        if (!full) break;
+      }
+
+      for (auto ry = y; ry < y1; ++ry) {
+        for (auto rx = x; rx < x1; ++rx) taken_[ry * kChunkSize_ + rx] = 1;
+      }
+
+      c.rects.push_back({
+          static_cast<u16>(ox + x),
+          static_cast<u16>(oy + y),
+          static_cast<u16>(ox + x1),
+          static_cast<u16>(oy + y1),
+      });
+    }
+  }
+}
+}  // namespace rl
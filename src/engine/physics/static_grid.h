@@ -0,0 +1,108 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ENGINE_PHYSICS_STATIC_GRID_H_
+#define ENGINE_PHYSICS_STATIC_GRID_H_
+
+#include "engine/common.h"
+#include "engine/core/handle.h"
+#include "engine/physics/collider.h"
+#include "engine/physics/physics.h"
+
+namespace rl {
+struct StaticGridDesc {
+  Position origin{Position::zero()};  // Min corner of cell (0, 0).
+  Distance cellSize{32.0f};
+  u16 width{0};
+  u16 height{0};
+};
+
+struct StaticGridTag {};
+using StaticGridHandle = Handle<StaticGridTag>;
+
+// A rectangle of solid cells, max excluded.
+struct StaticRect {
+  u16 x0{0};
+  u16 y0{0};
+  u16 x1{0};
+  u16 y1{0};
+};
+
+// Solid cells of static geometry (walls, props) as a bitset, with the solid
+// runs of each chunk merged into a few rectangles. Cells off the grid never
+// block.
+class StaticGrid {
+ public:
+  void init(const StaticGridDesc& desc);
+  void clear();
+
+  void solid(u16 x, u16 y, bool isSolid);
+  [[nodiscard]] bool solid(u16 x, u16 y) const;
+
+  // Merges the chunks edited since the last call again.
+  void rebuild();
+
+  // Cells covering a, clamped to the grid. False if a is off the grid.
+  bool cellsOf(const Aabb& a, u16& x0, u16& y0, u16& x1, u16& y1) const;
+  // Whether any cell in the range, max included, is solid.
+  [[nodiscard]] bool anySolid(u16 x0, u16 y0, u16 x1, u16 y1) const;
+
+  // Calls fn with every merged rectangle of the chunks holding the range, max
+  // included. Rectangles from chunks edited since rebuild are stale.
+  template <typename Fn>
+  void rects(u16 x0, u16 y0, u16 x1, u16 y1, Fn&& fn) const {
+    for (auto cy = y0 / kChunkSize_; cy <= y1 / kChunkSize_; ++cy) {
+      for (auto cx = x0 / kChunkSize_; cx <= x1 / kChunkSize_; ++cx) {
+        for (const auto& r : chunks_[cy * chunkW_ + cx].rects) {
+          if (r.x1 <= x0 || r.x0 > x1 || r.y1 <= y0 || r.y0 > y1) continue;
+          fn(r);
+        }
+      }
+    }
+  }
+
+  [[nodiscard]] Aabb aabbOf(const StaticRect& r) const;
+
+  [[nodiscard]] bool empty() const noexcept { return solidCount_ == 0; }
+  [[nodiscard]] Distance cellSize() const noexcept { return cellSize_; }
+
+ private:
+  inline static constexpr u16 kChunkSize_ = 16;
+  struct Chunk {
+    std::vector<StaticRect> rects{};
+    bool dirty{false};
+  };
+
+  Position origin_{Position::zero()};
+  Distance cellSize_{32.0f};
+  u16 w_{0};
+  u16 h_{0};
+  u16 chunkW_{0};
+  u16 chunkH_{0};
+  usize solidCount_{0};
+  std::vector<u64> bits_{};
+  std::vector<Chunk> chunks_{};
+  std::vector<u32> dirty_{};  // Chunk indices.
+  std::vector<u8> taken_{};   // Per chunk cell, while merging.
+
+  [[nodiscard]] usize bit(u16 x, u16 y) const {
+    return static_cast<usize>(y) * w_ + x;
+  }
+
+  void merge(u32 chunk);
+};
+}  // namespace rl
+
+#endif  // ENGINE_PHYSICS_STATIC_GRID_H_
@@ -0,0 +1,131 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "step_governor.h"
+////////////////////////////////////////////////////////////////////////////////
+
+#include "engine/core/type_trait.h"
+
+namespace rl {
+void StepGovernor::reset() {
+  stats_ = {};
+  changed_ = false;
+  reportedLevel_ = StepGovernorLevel::Normal;
+  reportedStepCount_ = 0;
+  overCount_ = 0;
+  underCount_ = 0;
+}
+
+void StepGovernor::deterministic(bool deterministic) {
+  deterministic_ = deterministic;
+  if (!deterministic_) return;
+
+  // Case: a session started while simulation work was being skipped.
+  if (stats_.level != StepGovernorLevel::Dilate) {
+    stats_.level = StepGovernorLevel::Normal;
+  }
+}
+
+u32 StepGovernor::allowedStepCount() const noexcept {
+  auto maxCount = std::max<u32>(config_.maxStepCount, 1);
+  if (deterministic_ || stats_.stepCost <= .0) return maxCount;
+  auto count = std::min(config_.frameBudget / stats_.stepCost,
+                        static_cast<f64>(maxCount));
+  return std::max<u32>(static_cast<u32>(count), 1);
+}
+
+bool StepGovernor::dropsLod() const noexcept {
+  return !deterministic_ && stats_.level >= StepGovernorLevel::DropLod;
+}
+
+bool StepGovernor::skipsPhases() const noexcept {
+  return !deterministic_ && stats_.level >= StepGovernorLevel::SkipPhases;
+}
+
+void StepGovernor::measure(f64 seconds) {
+  auto& cost = stats_.stepCost;
+
+  if (cost <= .0) {
+    cost = seconds;
+  } else {
+    cost += (seconds - cost) * config_.costSmoothing;
+  }
+}
+
+f64 StepGovernor::settle(f64 lag, f64 delta, f64 step, u32 stepCount) {
+  using enum StepGovernorLevel;
+  stats_.stepCount = stepCount;
+  stats_.allowedStepCount = allowedStepCount();
+
+  if (lag >= step) {
+    ++stats_.overBudgetFrames;
+    ++overCount_;
+    underCount_ = 0;
+  } else {
+    ++underCount_;
+    overCount_ = 0;
+  }
+
+  if (overCount_ >= config_.escalateFrameCount && stats_.level != Dilate) {
+    stats_.level = next(stats_.level);
+    ++stats_.escalations;
+    overCount_ = 0;
+  } else if (underCount_ >= config_.recoverFrameCount &&
+             stats_.level != Normal) {
+    stats_.level = previous(stats_.level);
+    ++stats_.recoveries;
+    underCount_ = 0;
+  }
+
+  // Case: the lag carried is bounded even before dilating, or it would grow
+  // as long as the frame stays over budget. Dilating keeps the fraction of a
+  // step so rendering still interpolates.
+  auto maxLag = step * std::max<u32>(config_.maxStepCount, 1);
+  auto kept = stats_.level == Dilate ? std::fmod(lag, step)
+                                     : std::min(lag, maxLag);
+  auto dropped = lag - kept;
+  stats_.droppedLag += dropped;
+  stats_.dilation =
+      delta > .0 ? std::clamp(1.0 - dropped / delta, .0, 1.0) : 1.0;
+
+  changed_ = stats_.level != reportedLevel_ ||
+             stats_.allowedStepCount != reportedStepCount_;
+  reportedLevel_ = stats_.level;
+  reportedStepCount_ = stats_.allowedStepCount;
+  return kept;
+}
+
+StepGovernorLevel StepGovernor::next(StepGovernorLevel level) const noexcept {
+  if (deterministic_ || level >= StepGovernorLevel::SkipPhases) {
+    return StepGovernorLevel::Dilate;
+  }
+
+  return static_cast<StepGovernorLevel>(toUnderlying(level) + 1);
+}
+
+StepGovernorLevel StepGovernor::previous(
+    StepGovernorLevel level) const noexcept {
+  if (deterministic_ || level <= StepGovernorLevel::DropLod) {
+    return StepGovernorLevel::Normal;
+  }
+
+  return static_cast<StepGovernorLevel>(toUnderlying(level) - 1);
+}
+}  // namespace rl
@@ -0,0 +1,98 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ENGINE_PHYSICS_STEP_GOVERNOR_H_
+#define ENGINE_PHYSICS_STEP_GOVERNOR_H_
+
+#include "engine/common.h"
+#include "engine/core/frame.h"
+
+namespace rl {
+// Each level keeps the ones before it.
+enum class StepGovernorLevel : u8 {
+  Normal = 0,
+  DropLod,     // Relevance tiers are one notch coarser.
+  SkipPhases,  // Optional work only runs on the last step of a frame.
+  Dilate,      // Lag the allowed steps cannot catch up with is dropped.
+};
+
+struct StepGovernorConfig {
+  f64 frameBudget{kFixedStep};  // Wall seconds the steps of a frame may take.
+  u32 maxStepCount{5};
+  u32 escalateFrameCount{4};  // Frames in a row over budget to degrade.
+  u32 recoverFrameCount{60};  // Frames in a row within budget to recover.
+  f64 costSmoothing{.1};
+};
+
+struct StepGovernorStats {
+  StepGovernorLevel level{StepGovernorLevel::Normal};
+  u32 allowedStepCount{0};
+  u32 stepCount{0};    // Of the last frame.
+  f64 stepCost{.0};    // Smoothed wall seconds of one step.
+  f64 dilation{1.0};   // Of the last frame, simulated over elapsed time.
+  f64 droppedLag{.0};  // Seconds never simulated, in total.
+  u64 overBudgetFrames{0};
+  u64 escalations{0};
+  u64 recoveries{0};
+};
+
+// Keeps the fixed steps of a frame within its budget. The allowed step count
+// follows the measured cost of a step. Lag left after them means the frame is
+// over budget, and the governor degrades one level at a time until it is not.
+// Wall time only decides how many steps run and how much work they skip.
+class StepGovernor {
+ public:
+  void reset();
+
+  // Replays and rollback sessions must simulate the same way on any host:
+  // steps per frame are not budgeted there and only dilation is allowed.
+  void deterministic(bool deterministic);
+
+  u32 allowedStepCount() const noexcept;
+  // Whether the level's work shedding applies, never in deterministic mode.
+  bool dropsLod() const noexcept;
+  bool skipsPhases() const noexcept;
+  void measure(f64 seconds);
+  // Once the frame's steps ran. Returns the lag to carry to the next frame.
+  f64 settle(f64 lag, f64 delta, f64 step, u32 stepCount);
+
+  // Whether the level or the allowed step count changed on the last settle.
+  [[nodiscard]] bool changed() const noexcept { return changed_; }
+  [[nodiscard]] StepGovernorLevel level() const noexcept {
+    return stats_.level;
+  }
+  [[nodiscard]] const StepGovernorStats& stats() const noexcept {
+    return stats_;
+  }
+
+  void config(const StepGovernorConfig& config) { config_ = config; }
+  const StepGovernorConfig& config() const noexcept { return config_; }
+
+ private:
+  StepGovernorConfig config_{};
+  StepGovernorStats stats_{};
+  bool deterministic_{false};
+  bool changed_{false};
+  StepGovernorLevel reportedLevel_{StepGovernorLevel::Normal};
+  u32 reportedStepCount_{0};
+  u32 overCount_{0};
+  u32 underCount_{0};
+
+  StepGovernorLevel next(StepGovernorLevel level) const noexcept;
+  StepGovernorLevel previous(StepGovernorLevel level) const noexcept;
+};
+}  // namespace rl
+
+#endif  // ENGINE_PHYSICS_STEP_GOVERNOR_H_
@@ -0,0 +1,61 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ENGINE_RELEVANCE_RELEVANCE_H_
+#define ENGINE_RELEVANCE_RELEVANCE_H_
+
+#include "engine/anim/anim_runtime.h"
+#include "engine/common.h"
+#include "engine/core/handle.h"
+#include "engine/relevance/relevance_type.h"
+#include "engine/transform/transform.h"
+
+namespace rl {
+struct RelevanceTag {};
+using RelevanceHandle = Handle<RelevanceTag>;
+
+using RelevanceFlags = u8;
+
+enum RelevanceFlagBits : RelevanceFlags {
+  kRelevanceFlagBitsNone = 0x0,
+  // Anchors (e.g. players) are always Full and keep their surroundings Full.
+  kRelevanceFlagBitsAnchor = 0x1,
+  kRelevanceFlagBitsAll = static_cast<RelevanceFlags>(-1),
+};
+
+struct RelevanceDesc {
+  RelevanceFlags flags{kRelevanceFlagBitsNone};
+  TransformHandle trans{kInvalidHandle};
+  AnimatorHandle animator{kInvalidHandle};
+};
+
+struct Relevance {
+  RelevanceFlags flags{kRelevanceFlagBitsNone};
+  RelevanceTier tier{RelevanceTier::Full};
+  RelevanceHandle handle{kInvalidHandle};
+  TransformHandle trans{kInvalidHandle};
+  AnimatorHandle animator{kInvalidHandle};
+};
+
+struct RelevanceConfig {
+  // Distances are measured from the closest camera view or anchor.
+  Distance fullMargin{128.0f};
+  Distance reducedDist{1024.0f};
+  Distance hysteresis{64.0f};
+  u32 refreshInterval{8};  // Fixed steps between two tier refreshes.
+};
+}  // namespace rl
+
+#endif  // ENGINE_RELEVANCE_RELEVANCE_H_
@@ -0,0 +1,196 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "relevance_system.h"
+////////////////////////////////////////////////////////////////////////////////
+
+#include "engine/anim/anim_system.h"
+#include "engine/camera/camera_system.h"
+#include "engine/core/log.h"
+#include "engine/core/type_trait.h"
+#include "engine/core/vector.h"
+#include "engine/transform/transform_system.h"
+
+namespace rl {
+RelevanceSystem& RelevanceSystem::instance() {
+  static RelevanceSystem inst;
+  return inst;
+}
+
+void RelevanceSystem::init() {
+  RL_LOG_DEBUG("RelevanceSystem::init");
+  constexpr auto kRelevanceCapacity = 256;
+  tickCount_ = 0;
+  degraded_ = false;
+  hRelevancePool_.clear();
+  hRelevancePool_.reserve(kRelevanceCapacity);
+  entries_.reserve(kRelevanceCapacity);
+}
+
+void RelevanceSystem::shutdown() {
+  RL_LOG_DEBUG("RelevanceSystem::shutdown");
+  hRelevancePool_.clear();
+  entries_.clear();
+  anchors_.clear();
+}
+
+void RelevanceSystem::save(SnapshotWriter& w) const {
+  w.write(tickCount_);
+  hRelevancePool_.save(w);
+  w.write(entries_);
+}
+
+bool RelevanceSystem::restore(SnapshotReader& r) {
+  return r.read(tickCount_) && hRelevancePool_.restore(r) &&
+         r.read(entries_);
+}
+
+void RelevanceSystem::tick(const FramePacket&) {
+  auto interval = std::max<u32>(config_.refreshInterval, 1);
+  auto refreshNow = tickCount_++ % interval == 0;
+  if (!refreshNow || entries_.empty()) return;
+
+  gatherAnchors();
+
+  for (auto& r : entries_) {
+    if (!r.handle) continue;
+    refresh(r);
+  }
+}
+
+RelevanceHandle RelevanceSystem::generate(const RelevanceDesc& desc) {
+  auto h = hRelevancePool_.generate();
+  ensureCapacity(entries_, h.index);
+  auto& r = entries_[h.index];
+  r.handle = h;
+  r.flags = desc.flags;
+  r.tier = RelevanceTier::Full;
+  r.trans = desc.trans;
+  r.animator = desc.animator;
+  return h;
+}
+
+void RelevanceSystem::destroy(RelevanceHandle h) {
+  auto* r = relevance(h);
+  if (!r) return;
+  *r = {};
+  hRelevancePool_.destroy(h);
+}
+
+RelevanceTier RelevanceSystem::tier(RelevanceHandle h) const noexcept {
+  if (!h || !hRelevancePool_.alive(h)) return RelevanceTier::Full;
+  return entries_[h.index].tier;
+}
+
+bool RelevanceSystem::shouldTick(RelevanceHandle h) const noexcept {
+  return relevantTick(tier(h), tickCount_, h.index);
+}
+
+f64 RelevanceSystem::step(RelevanceHandle h, f64 step) const noexcept {
+  return relevanceStep(tier(h), step);
+}
+
+void RelevanceSystem::gatherAnchors() {
+  anchors_.clear();
+
+  RL_CCAMSYS.forEach([&](const Camera& c) {
+    auto size = RL_CCAMSYS.worldSize(&c);
+
+    anchors_.push_back({
+        .center = RL_CCAMSYS.worldCenter(&c),
+        .halfExtents = {size.x * .5f, size.y * .5f},
+    });
+  });
+
+  for (const auto& r : entries_) {
+    if (!r.handle || !(r.flags & kRelevanceFlagBitsAnchor)) continue;
+    const auto* t = RL_CTRANSSYS.global(r.trans);
+    if (!t) continue;
+    anchors_.push_back({.center = t->pos, .halfExtents = {}});
+  }
+}
+
+void RelevanceSystem::refresh(Relevance& r) {
+  if (r.flags & kRelevanceFlagBitsAnchor) {
+    apply(r, RelevanceTier::Full);
+    return;
+  }
+
+  const auto* t = RL_CTRANSSYS.global(r.trans);
+  if (!t) return;
+  apply(r, computeTier(r, t->pos));
+}
+
+RelevanceTier RelevanceSystem::computeTier(const Relevance& r,
+                                           const Position& p) const {
+  // Case: no camera nor anchor, nothing to be relevant to.
+  if (anchors_.empty()) return RelevanceTier::Full;
+  auto best = std::numeric_limits<Distance>::max();
+
+  for (const auto& a : anchors_) {
+    auto dx = std::max(.0f, std::fabs(p.x - a.center.x) - a.halfExtents.x);
+    auto dy = std::max(.0f, std::fabs(p.y - a.center.y) - a.halfExtents.y);
+    best = std::min(best, dx * dx + dy * dy);
+  }
+
+  // Case: demotions need to go past the threshold plus hysteresis so entities
+  // on a border do not flicker between tiers.
+  auto full = config_.fullMargin;
+  auto reduced = config_.reducedDist;
+
+  if (r.tier == RelevanceTier::Full) {
+    full += config_.hysteresis;
+    reduced += config_.hysteresis;
+  } else if (r.tier == RelevanceTier::Reduced) {
+    reduced += config_.hysteresis;
+  }
+
+  auto tier = RelevanceTier::Dormant;
+
+  if (best <= full * full) {
+    tier = RelevanceTier::Full;
+  } else if (best <= reduced * reduced) {
+    tier = RelevanceTier::Reduced;
+  }
+
+  if (!degraded_ || best <= .0f || tier == RelevanceTier::Dormant) return tier;
+  return static_cast<RelevanceTier>(toUnderlying(tier) + 1);
+}
+
+void RelevanceSystem::apply(Relevance& r, RelevanceTier tier) {
+  if (r.tier == tier) return;
+  r.tier = tier;
+  if (r.animator) RL_ANIMSYS.tier(r.animator, tier);
+}
+
+Relevance* RelevanceSystem::relevance(RelevanceHandle h) {
+  RL_ASSERT(h && hRelevancePool_.alive(h),
+            "RelevanceSystem::relevance: Invalid relevance handle provided!");
+  if (!h || !hRelevancePool_.alive(h)) return nullptr;
+  return &entries_[h.index];
+}
+
+const Relevance* RelevanceSystem::relevance(RelevanceHandle h) const {
+  RL_ASSERT(h && hRelevancePool_.alive(h),
+            "RelevanceSystem::relevance: Invalid relevance handle provided!");
+  if (!h || !hRelevancePool_.alive(h)) return nullptr;
+  return &entries_[h.index];
+}
+}  // namespace rl
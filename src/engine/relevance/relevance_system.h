@@ -0,0 +1,86 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ENGINE_RELEVANCE_RELEVANCE_SYSTEM_H_
+#define ENGINE_RELEVANCE_RELEVANCE_SYSTEM_H_
+
+#include "engine/common.h"
+#include "engine/core/frame.h"
+#include "engine/core/handle.h"
+#include "engine/relevance/relevance.h"
+#include "engine/relevance/relevance_type.h"
+#include "engine/snapshot/snapshot.h"
+
+namespace rl {
+class RelevanceSystem {
+ public:
+  static RelevanceSystem& instance();
+
+  void init();
+  void shutdown();
+
+  void save(SnapshotWriter& w) const;
+  bool restore(SnapshotReader& r);
+
+  void tick(const FramePacket& f);
+
+  [[nodiscard]] RelevanceHandle generate(const RelevanceDesc& desc);
+  void destroy(RelevanceHandle h);
+
+  RelevanceTier tier(RelevanceHandle h) const noexcept;
+  bool shouldTick(RelevanceHandle h) const noexcept;
+  f64 step(RelevanceHandle h, f64 step) const noexcept;
+
+  Frame tickCount() const noexcept { return tickCount_; }
+
+  // Entities outside every view and anchor get one tier coarser from the next
+  // refresh on, to shed work when the frame is over budget.
+  void degrade(bool degraded) noexcept { degraded_ = degraded; }
+  bool degraded() const noexcept { return degraded_; }
+
+  void config(const RelevanceConfig& config) { config_ = config; }
+  const RelevanceConfig& config() const noexcept { return config_; }
+
+ private:
+  struct Anchor {
+    Position center{};
+    Position halfExtents{};
+  };
+
+  Frame tickCount_{0};
+  bool degraded_{false};
+  RelevanceConfig config_{};
+  HandlePool<RelevanceTag> hRelevancePool_{};
+  std::vector<Relevance> entries_{};
+  std::vector<Anchor> anchors_{};
+
+  RelevanceSystem() = default;
+
+  void gatherAnchors();
+  void refresh(Relevance& r);
+  RelevanceTier computeTier(const Relevance& r, const Position& p) const;
+  void apply(Relevance& r, RelevanceTier tier);
+
+  Relevance* relevance(RelevanceHandle h);
+  const Relevance* relevance(RelevanceHandle h) const;
+};
+}  // namespace rl
+
+#define RL_RELEVSYS (::rl::RelevanceSystem::instance())
+#define RL_CRELEVSYS                          \
+  (static_cast<const ::rl::RelevanceSystem&>( \
+      ::rl::RelevanceSystem::instance()))
+
+#endif  // ENGINE_RELEVANCE_RELEVANCE_SYSTEM_H_
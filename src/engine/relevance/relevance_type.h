@@ -0,0 +1,58 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ENGINE_RELEVANCE_RELEVANCE_TYPE_H_
+#define ENGINE_RELEVANCE_RELEVANCE_TYPE_H_
+
+#include "engine/common.h"
+#include "engine/core/frame.h"
+
+namespace rl {
+enum class RelevanceTier : u8 { Full = 0, Reduced, Dormant };
+
+// Reduced entities tick once every kRelevanceReducedStride fixed steps.
+constexpr u32 kRelevanceReducedStride = 4;
+
+[[nodiscard]] inline constexpr u32 relevanceStride(
+    RelevanceTier tier) noexcept {
+  switch (tier) {
+    using enum RelevanceTier;
+    case Full:
+      return 1;
+    case Reduced:
+      return kRelevanceReducedStride;
+    case Dormant:
+    default:
+      return 0;
+  }
+}
+
+// Salt spreads reduced entities over the stride so they do not all land on
+// the same fixed step.
+[[nodiscard]] inline constexpr bool relevantTick(RelevanceTier tier,
+                                                 Frame tick,
+                                                 u32 salt) noexcept {
+  auto stride = relevanceStride(tier);
+  if (stride <= 1) return stride == 1;
+  return (tick + salt) % stride == 0;
+}
+
+[[nodiscard]] inline constexpr f64 relevanceStep(RelevanceTier tier,
+                                                 f64 step) noexcept {
+  return step * static_cast<f64>(std::max<u32>(relevanceStride(tier), 1));
+}
+}  // namespace rl
+
+#endif  // ENGINE_RELEVANCE_RELEVANCE_TYPE_H_
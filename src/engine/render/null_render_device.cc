@@ -0,0 +1,56 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "null_render_device.h"
+////////////////////////////////////////////////////////////////////////////////
+
+#include "engine/camera/camera_system.h"
+#include "engine/render/render_utils.h"
+
+namespace rl {
+void NullRenderDevice::init(WindowSize width, WindowSize height,
+                            std::string_view, WindowSize refWidth,
+                            WindowSize refHeight) {
+  width_ = width;
+  height_ = height;
+  textureCounter_ = 0;
+  refSize(refWidth, refHeight);
+}
+
+void NullRenderDevice::shutdown() {
+  viewport_ = {};
+  textureCounter_ = 0;
+}
+
+void NullRenderDevice::render(RenderQueue&) {}
+
+void NullRenderDevice::refSize(WindowSize w, WindowSize h) {
+  refWidth_ = w;
+  refHeight_ = h;
+  viewport_ = fitInside(width_, height_, refWidth_, refHeight_);
+  RL_CAMSYS.resizeAll(viewport_);
+}
+
+bool NullRenderDevice::generateTexture(const TextureExtent&, const void*,
+                                       u64& out) {
+  out = ++textureCounter_;
+  return true;
+}
+}  // namespace rl
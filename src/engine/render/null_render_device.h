@@ -0,0 +1,53 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ENGINE_RENDER_NULL_RENDER_DEVICE_H_
+#define ENGINE_RENDER_NULL_RENDER_DEVICE_H_
+
+#include "engine/common.h"
+#include "engine/render/render_device.h"
+#include "engine/texture/texture.h"
+
+namespace rl {
+// No window, no context: keeps a viewport for cameras and hands out texture
+// handles so resource loading behaves as in a windowed run.
+class NullRenderDevice : public RenderDevice {
+ public:
+  void init(WindowSize width, WindowSize height,
+            std::string_view windowTitle = kDefaultWindowTitle_,
+            WindowSize refWidth = kDefaultRefWidth_,
+            WindowSize refHeight = kDefaultRefHeight_) override;
+  void shutdown() override;
+
+  void render(RenderQueue& queue) override;
+  void windowTitle(std::string_view) override {}
+  void refSize(WindowSize w, WindowSize h) override;
+
+  bool generateTexture(const TextureExtent& size, const void* data,
+                       u64& out) override;
+  void destroyTexture(u64) override {}
+
+  const Viewport& viewport() const noexcept override { return viewport_; }
+  void* window() override { return nullptr; }
+
+ private:
+  Viewport viewport_{};
+  WindowSize width_{0};
+  WindowSize height_{0};
+  u64 textureCounter_{0};
+};
+}  // namespace rl
+
+#endif  // ENGINE_RENDER_NULL_RENDER_DEVICE_H_
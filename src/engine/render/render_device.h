@@ -22,6 +22,8 @@
 #include "engine/texture/texture.h"
 
 namespace rl {
+enum class RenderDeviceKind : u8 { OpenGl, Null };
+
 class RenderDevice {
  public:
   virtual void init(WindowSize width, WindowSize height,
@@ -22,6 +22,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "engine/core/phase_bus.h"
+#include "engine/render/null_render_device.h"
 #include "engine/render/opengl_render_device.h"
 
 namespace rl {
@@ -30,9 +31,20 @@ RenderSystem& RenderSystem::instance() {
   return inst;
 }
 
-void RenderSystem::init() {
+void RenderSystem::init(RenderDeviceKind kind) {
   RL_LOG_DEBUG("RenderSystem::init");
-  device_ = std::make_unique<OpenGlRenderDevice>();
+  kind_ = kind;
+
+  switch (kind) {
+    case RenderDeviceKind::Null:
+      device_ = std::make_unique<NullRenderDevice>();
+      break;
+    case RenderDeviceKind::OpenGl:
+    default:
+      device_ = std::make_unique<OpenGlRenderDevice>();
+      break;
+  }
+
   device_->init(kWindowWidth, kWindowHeight, kWindowTitle);
 }
 
@@ -29,7 +29,7 @@ class RenderSystem {
  public:
   static RenderSystem& instance();
 
-  void init();
+  void init(RenderDeviceKind kind = RenderDeviceKind::OpenGl);
   void shutdown();
 
   void update(const FramePacket& f);
@@ -42,6 +42,7 @@ class RenderSystem {
   const RenderQueue* queue() const { return &queue_; }
 
   const Viewport& viewport() const noexcept { return device_->viewport(); }
+  RenderDeviceKind deviceKind() const noexcept { return kind_; }
 
  private:
   static constexpr WindowSize kWindowWidth = 1280;
@@ -49,6 +50,7 @@ class RenderSystem {
   static constexpr std::string_view kWindowTitle = "Rogue Like";
 
   std::unique_ptr<RenderDevice> device_{nullptr};
+  RenderDeviceKind kind_{RenderDeviceKind::OpenGl};
   RenderQueue queue_{};
 
   RenderSystem() = default;
@@ -0,0 +1,103 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "snapshot.h"
+////////////////////////////////////////////////////////////////////////////////
+
+namespace rl {
+namespace internal {
+constexpr usize kSnapshotDeltaBlockSize = 64;
+}  // namespace internal
+
+void diffSnapshot(const Snapshot& base, const Snapshot& cur,
+                  SnapshotDelta& out) {
+  using internal::kSnapshotDeltaBlockSize;
+  out.clear();
+  out.baseTick = base.tick;
+  out.tick = cur.tick;
+  out.size = static_cast<u32>(cur.bytes.size());
+  out.sections = cur.sections;
+
+  const auto* a = base.bytes.data();
+  const auto* b = cur.bytes.data();
+  auto shared = std::min(base.bytes.size(), cur.bytes.size());
+  auto total = cur.bytes.size();
+  usize offset = 0;
+
+  auto push = [&](usize begin, usize end) {
+    out.runs.push_back({
+        .offset = static_cast<u32>(begin),
+        .size = static_cast<u32>(end - begin),
+        .data = static_cast<u32>(out.bytes.size()),
+    });
+
+    out.bytes.insert(out.bytes.end(), b + begin, b + end);
+  };
+
+  while (offset < shared) {
+    auto size = std::min(kSnapshotDeltaBlockSize, shared - offset);
+
+    if (std::memcmp(a + offset, b + offset, size) == 0) {
+      offset += size;
+      continue;
+    }
+
+    // Case: extend the run over consecutive changed blocks.
+    auto begin = offset;
+    offset += size;
+
+    while (offset < shared) {
+      size = std::min(kSnapshotDeltaBlockSize, shared - offset);
+      if (std::memcmp(a + offset, b + offset, size) == 0) break;
+      offset += size;
+    }
+
+    if (offset >= shared && total > shared) {
+      push(begin, total);
+      return;
+    }
+
+    push(begin, offset);
+  }
+
+  if (total > shared) push(shared, total);
+}
+
+bool patchSnapshot(const Snapshot& base, const SnapshotDelta& delta,
+                   Snapshot& out) {
+  RL_ASSERT(base.tick == delta.baseTick,
+            "patchSnapshot: Delta was not made against this base!");
+  if (base.tick != delta.baseTick) return false;
+
+  if (&out != &base) out.bytes = base.bytes;
+  out.bytes.resize(delta.size);
+  out.sections = delta.sections;
+  out.tick = delta.tick;
+
+  for (const auto& r : delta.runs) {
+    if (r.offset + r.size > out.bytes.size()) return false;
+    if (r.data + r.size > delta.bytes.size()) return false;
+    std::memcpy(out.bytes.data() + r.offset, delta.bytes.data() + r.data,
+                r.size);
+  }
+
+  return true;
+}
+}  // namespace rl
@@ -0,0 +1,167 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ENGINE_SNAPSHOT_SNAPSHOT_H_
+#define ENGINE_SNAPSHOT_SNAPSHOT_H_
+
+#include "engine/common.h"
+#include "engine/core/frame.h"
+#include "engine/core/hash.h"
+#include "engine/core/serialize.h"
+
+namespace rl {
+using SnapshotSectionId = HashValue;
+
+[[nodiscard]] constexpr SnapshotSectionId snapshotSectionId(
+    std::string_view name) noexcept {
+  return fnv1a32(name);
+}
+
+struct SnapshotSection {
+  SnapshotSectionId id{kInvalidHashValue};
+  u32 offset{0};
+  u32 size{0};
+};
+
+// One contiguous buffer, one section per system. Snapshots are process-local:
+// they keep resource and callback pointers as-is.
+struct Snapshot {
+  Frame tick{0};
+  std::vector<std::byte> bytes{};
+  std::vector<SnapshotSection> sections{};
+
+  void clear() {
+    tick = 0;
+    bytes.clear();
+    sections.clear();
+  }
+
+  [[nodiscard]] const SnapshotSection* section(
+      SnapshotSectionId id) const noexcept {
+    for (const auto& s : sections) {
+      if (s.id == id) return &s;
+    }
+
+    return nullptr;
+  }
+};
+
+struct SnapshotDeltaRun {
+  u32 offset{0};
+  u32 size{0};
+  u32 data{0};  // Offset in SnapshotDelta::bytes.
+};
+
+// Changed byte runs of a snapshot against a base, at block granularity.
+struct SnapshotDelta {
+  Frame baseTick{0};
+  Frame tick{0};
+  u32 size{0};
+  std::vector<SnapshotSection> sections{};
+  std::vector<SnapshotDeltaRun> runs{};
+  std::vector<std::byte> bytes{};
+
+  void clear() {
+    baseTick = 0;
+    tick = 0;
+    size = 0;
+    sections.clear();
+    runs.clear();
+    bytes.clear();
+  }
+};
+
+class SnapshotWriter {
+ public:
+  explicit SnapshotWriter(std::vector<std::byte>& out) noexcept : out_{out} {}
+
+  void write(const void* data, usize size) {
+    if (size == 0) return;
+    auto offset = out_.size();
+    out_.resize(offset + size);
+    std::memcpy(out_.data() + offset, data, size);
+  }
+
+  template <TriviallySerializable T>
+  void write(const T& value) {
+    write(&value, sizeof(T));
+  }
+
+  template <TriviallySerializable T>
+  void write(std::span<const T> values) {
+    auto count = static_cast<u32>(values.size());
+    write(count);
+    write(values.data(), values.size_bytes());
+  }
+
+  template <TriviallySerializable T>
+  void write(const std::vector<T>& values) {
+    write(std::span<const T>{values});
+  }
+
+ private:
+  std::vector<std::byte>& out_;
+};
+
+class SnapshotReader {
+ public:
+  explicit SnapshotReader(std::span<const std::byte> in) noexcept : in_{in} {}
+
+  bool read(void* data, usize size) {
+    if (size > in_.size() - cursor_) {
+      ok_ = false;
+      return false;
+    }
+
+    if (size > 0) std::memcpy(data, in_.data() + cursor_, size);
+    cursor_ += size;
+    return true;
+  }
+
+  template <TriviallySerializable T>
+  bool read(T& value) {
+    return read(&value, sizeof(T));
+  }
+
+  template <TriviallySerializable T>
+  bool read(std::vector<T>& values) {
+    u32 count{0};
+    if (!read(count)) return false;
+
+    if (static_cast<usize>(count) * sizeof(T) > in_.size() - cursor_) {
+      ok_ = false;
+      return false;
+    }
+
+    values.resize(count);
+    return read(values.data(), static_cast<usize>(count) * sizeof(T));
+  }
+
+  [[nodiscard]] bool ok() const noexcept { return ok_; }
+  [[nodiscard]] bool done() const noexcept { return cursor_ == in_.size(); }
+
+ private:
+  std::span<const std::byte> in_{};
+  usize cursor_{0};
+  bool ok_{true};
+};
+
+void diffSnapshot(const Snapshot& base, const Snapshot& cur,
+                  SnapshotDelta& out);
+bool patchSnapshot(const Snapshot& base, const SnapshotDelta& delta,
+                   Snapshot& out);
+}  // namespace rl
+
+#endif  // ENGINE_SNAPSHOT_SNAPSHOT_H_
@@ -0,0 +1,89 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "snapshot_system.h"
+////////////////////////////////////////////////////////////////////////////////
+
+namespace rl {
+SnapshotSystem& SnapshotSystem::instance() {
+  static SnapshotSystem inst;
+  return inst;
+}
+
+void SnapshotSystem::init() {
+  RL_LOG_DEBUG("SnapshotSystem::init");
+  entries_.clear();
+}
+
+void SnapshotSystem::shutdown() {
+  RL_LOG_DEBUG("SnapshotSystem::shutdown");
+  entries_.clear();
+}
+
+void SnapshotSystem::on(std::string_view name, SnapshotSaveFn save,
+                        SnapshotRestoreFn restore) {
+  auto id = snapshotSectionId(name);
+  RL_ASSERT(save && restore, "SnapshotSystem::on: Missing callbacks for ",
+            name, "!");
+  RL_ASSERT(std::none_of(entries_.begin(), entries_.end(),
+                         [id](const auto& e) { return e.id == id; }),
+            "SnapshotSystem::on: Section already registered: ", name, "!");
+  entries_.push_back({id, name, save, restore});
+}
+
+void SnapshotSystem::capture(Snapshot& out, Frame tick) const {
+  // Case: reuse the previous buffer so steady-state captures do not allocate.
+  out.bytes.clear();
+  out.sections.clear();
+  out.tick = tick;
+  SnapshotWriter w{out.bytes};
+
+  for (const auto& e : entries_) {
+    auto offset = static_cast<u32>(out.bytes.size());
+    e.save(w);
+    out.sections.push_back({
+        .id = e.id,
+        .offset = offset,
+        .size = static_cast<u32>(out.bytes.size()) - offset,
+    });
+  }
+}
+
+bool SnapshotSystem::restore(const Snapshot& s) {
+  for (const auto& e : entries_) {
+    const auto* section = s.section(e.id);
+
+    if (!section) {
+      RL_LOG_ERR("SnapshotSystem::restore: Missing section: ", e.name, "!");
+      return false;
+    }
+
+    SnapshotReader r{std::span<const std::byte>{s.bytes}.subspan(
+        section->offset, section->size)};
+
+    if (!e.restore(r) || !r.ok() || !r.done()) {
+      RL_LOG_ERR("SnapshotSystem::restore: Corrupted section: ", e.name, "!");
+      return false;
+    }
+  }
+
+  return true;
+}
+}  // namespace rl
@@ -0,0 +1,59 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ENGINE_SNAPSHOT_SNAPSHOT_SYSTEM_H_
+#define ENGINE_SNAPSHOT_SNAPSHOT_SYSTEM_H_
+
+#include "engine/common.h"
+#include "engine/core/frame.h"
+#include "engine/snapshot/snapshot.h"
+
+namespace rl {
+using SnapshotSaveFn = void (*)(SnapshotWriter& w);
+using SnapshotRestoreFn = bool (*)(SnapshotReader& r);
+
+class SnapshotSystem {
+ public:
+  static SnapshotSystem& instance();
+
+  void init();
+  void shutdown();
+
+  // Sections are saved and restored in registration order.
+  void on(std::string_view name, SnapshotSaveFn save,
+          SnapshotRestoreFn restore);
+
+  void capture(Snapshot& out, Frame tick = 0) const;
+  bool restore(const Snapshot& s);
+
+ private:
+  struct Entry {
+    SnapshotSectionId id{kInvalidHashValue};
+    std::string_view name{};
+    SnapshotSaveFn save{nullptr};
+    SnapshotRestoreFn restore{nullptr};
+  };
+
+  std::vector<Entry> entries_{};
+
+  SnapshotSystem() = default;
+};
+}  // namespace rl
+
+#define RL_SNAPSHOTSYS (::rl::SnapshotSystem::instance())
+#define RL_CSNAPSHOTSYS \
+  (static_cast<const ::rl::SnapshotSystem&>(::rl::SnapshotSystem::instance()))
+
+#endif  // ENGINE_SNAPSHOT_SNAPSHOT_SYSTEM_H_
@@ -44,13 +44,14 @@ SoundSystem& SoundSystem::instance() {
   return inst;
 }
 
-void SoundSystem::init() {
+void SoundSystem::init(SoundDeviceKind kind) {
   RL_LOG_DEBUG("SoundSystem::init");
   constexpr auto kSoundCapacity = 512;
   hSoundPool_.clear();
   hSoundPool_.reserve(kSoundCapacity);
   sounds_.reserve(kSoundCapacity);
   busVolumes_.fill(1.0f);
+  if (kind == SoundDeviceKind::Null) return;
 
   deviceState_ = std::make_unique<SoundDeviceState>();
   deviceState_->shuttingDown = false;
@@ -147,6 +148,7 @@ void SoundSystem::play(SoundInstanceHandle h) {
 }
 
 void SoundSystem::playOnce(const OnceSound& os) {
+  if (muteOnce_) return;
   SoundInstanceDesc desc{};
   desc.playing = true;
   desc.flags = kSoundInstanceFlagBitsOnce;
@@ -22,11 +22,15 @@
 #include "engine/sound/sound_runtime.h"
 
 namespace rl {
+enum class SoundDeviceKind : u8 { Miniaudio, Null };
+
 class SoundSystem {
  public:
   static SoundSystem& instance();
 
-  void init();
+  // The null device keeps instances and positional state ticking but never
+  // opens an output or mixes.
+  void init(SoundDeviceKind kind = SoundDeviceKind::Miniaudio);
   void shutdown();
 
   void tick(const FramePacket&);
@@ -56,6 +60,10 @@ class SoundSystem {
   void masterVolume(f32 volume) { busVolume(kSoundBusMaster, volume); }
   f32 masterVolume() const { return busVolume(kSoundBusMaster); }
 
+  // While set, fire-and-forget sounds are dropped, so re-simulated ticks are
+  // not heard twice.
+  void muteOnce(bool mute) noexcept { muteOnce_ = mute; }
+
   void setBus(SoundInstanceHandle h, SoundBus bus) {
     if (bus >= kSoundBusCount) return;
     std::lock_guard lock{mutex_};
@@ -72,6 +80,7 @@ class SoundSystem {
   f32 panRange_{200.0f};
   f32 posMaxHearDist_{400.0f * 400.0f};
   f32 posMinHearDist_{2.0f * 2.0f};
+  bool muteOnce_{false};
 
   HandlePool<SoundInstanceTag> hSoundPool_{};
   std::vector<SoundInstance> sounds_{};
@@ -62,6 +62,19 @@ void TransformSystem::shutdown() {
   transformStack_.clear();
 }
 
+void TransformSystem::save(SnapshotWriter& w) const {
+  hTransPool_.save(w);
+  w.write(locals_);
+  w.write(globals_);
+  w.write(hierarchy_);
+  w.write(roots_);
+}
+
+bool TransformSystem::restore(SnapshotReader& r) {
+  return hTransPool_.restore(r) && r.read(locals_) && r.read(globals_) &&
+         r.read(hierarchy_) && r.read(roots_);
+}
+
 void TransformSystem::tick(FramePacket&) {
   transformStack_.clear();
 
@@ -20,6 +20,7 @@
 #include "engine/core/frame.h"
 #include "engine/core/handle.h"
 #include "engine/math/trs.h"
+#include "engine/snapshot/snapshot.h"
 #include "engine/transform/transform.h"
 
 namespace rl {
@@ -30,6 +31,9 @@ class TransformSystem {
   void init();
   void shutdown();
 
+  void save(SnapshotWriter& w) const;
+  bool restore(SnapshotReader& r);
+
   void tick(FramePacket&);
 
   [[nodiscard]] TransformHandle generate(TransformDesc desc);
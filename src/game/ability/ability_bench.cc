@@ -0,0 +1,104 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "ability_bench.h"
+////////////////////////////////////////////////////////////////////////////////
+
+#include "engine/core/log.h"
+#include "game/ability/ability_vm.h"
+#include "game/character/character.h"
+
+namespace rl {
+namespace internal {
+AbilityProgram makeBenchProgram() {
+  constexpr AnimTag kAnim = 1;
+  AbilityProgram prog{};
+
+  prog.code = {
+      {AbilityOp::PlayAnim, {kAnim}},
+      {AbilityOp::SetAnimSpeed, {1.25f}},
+      {AbilityOp::Sleep, {.0f}},
+      {AbilityOp::WaitAnim, {kAnim}},
+      {AbilityOp::SetCd, {1.0f}},
+      {AbilityOp::SetGcd, {.5f}},
+      {AbilityOp::NoOp, {}},
+      {AbilityOp::Sleep, {.05f}},
+      {AbilityOp::SetAnimSpeed, {1.0f}},
+  };
+
+  compileAbilityProgram(prog);
+  return prog;
+}
+
+using BenchExecFn = AbilityVMStatus (*)(Char&, AbilityVM&,
+                                        const AbilityProgram&);
+
+f64 runBench(BenchExecFn exec, const AbilityProgram& prog,
+             std::vector<Char>& chars, std::vector<AbilityVM>& vms,
+             Frame ticks) {
+  auto step = static_cast<f32>(kFixedStep);
+
+  // Case: staggered, so the VMs are not all on the same op at once.
+  for (usize i = 0; i < vms.size(); ++i) {
+    vms[i] = {};
+    vms[i].pc = static_cast<AbilityPC>(i % prog.compiled.size());
+  }
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (Frame t = 0; t < ticks; ++t) {
+    for (usize i = 0; i < vms.size(); ++i) {
+      auto& vm = vms[i];
+
+      if (vm.sleepTimer > .0f) {
+        vm.sleepTimer = std::max(.0f, vm.sleepTimer - step);
+        continue;
+      }
+
+      if (exec(chars[i], vm, prog) != AbilityVMStatus::Running) vm.pc = 0;
+    }
+  }
+
+  return std::chrono::duration<f64>(std::chrono::steady_clock::now() - start)
+      .count();
+}
+}  // namespace internal
+
+void runAbilityBench(usize vmCount, Frame ticks) {
+  auto prog = internal::makeBenchProgram();
+  std::vector<Char> chars(vmCount);
+  std::vector<AbilityVM> vms(vmCount);
+  auto vmTicks = static_cast<f64>(vmCount) * static_cast<f64>(ticks);
+
+  auto report = [&](std::string_view name, f64 seconds) {
+    RL_LOG_INFO("runAbilityBench: ", name, ": ", vmCount, " VMs, ", ticks,
+                " ticks in ", seconds, "s (", seconds / vmTicks * 1e9,
+                "ns per VM tick, ", seconds / static_cast<f64>(ticks) * 1e3,
+                "ms per tick).");
+  };
+
+  report("switch", internal::runBench(internal::execAbilityProgramSwitch,
+                                      prog, chars, vms, ticks));
+#ifdef RL_ABILITY_VM_THREADED
+  report("threaded",
+         internal::runBench(execAbilityProgram, prog, chars, vms, ticks));
+#endif  // RL_ABILITY_VM_THREADED
+}
+}  // namespace rl
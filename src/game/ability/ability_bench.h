@@ -13,14 +13,16 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
-#ifndef GAME_ABILITY_ABILITY_OPERATION_BINDINGS_H_
-#define GAME_ABILITY_ABILITY_OPERATION_BINDINGS_H_
+#ifndef GAME_ABILITY_ABILITY_BENCH_H_
+#define GAME_ABILITY_ABILITY_BENCH_H_
 
 #include "engine/common.h"
+#include "engine/core/frame.h"
 
 namespace rl {
-// Could be decentralized completely.
-void bindAbilityOperations();
+// Steps vmCount concurrent VMs over a looping program for the given ticks,
+// once per dispatch path, and logs the cost per VM tick.
+void runAbilityBench(usize vmCount = 10000, Frame ticks = 600);
 }  // namespace rl
 
-#endif  // GAME_ABILITY_ABILITY_OPERATION_BINDINGS_H_
+#endif  // GAME_ABILITY_ABILITY_BENCH_H_
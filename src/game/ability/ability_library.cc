@@ -24,8 +24,9 @@
 #include "engine/core/log.h"
 #include "engine/resource/resource_file.h"
 #include "engine/resource/resource_type_registry.h"
-#include "game/ability/ability_operation_bindings.h"
+#include "game/ability/ability_optimizer.h"
 #include "game/ability/ability_serialize.h"
+#include "game/ability/ability_vm.h"
 #include "game/resource/game_resource.h"
 
 namespace rl {
@@ -39,14 +40,11 @@ void AbilityLibrary::init() {
   RL_RESREG.on(kGameResourceTypeAbility, "ability");
   constexpr auto kAbilityCapacity = 256;
   slots_.reserve(kAbilityCapacity);
-  opFns_ = {};
-  bindAbilityOperations();
 }
 
 void AbilityLibrary::shutdown() {
   RL_LOG_DEBUG("AbilityLibrary::shutdown");
   slots_.clear();
-  opFns_ = {};
 }
 
 const AbilityResource* AbilityLibrary::load(AbilityId id) {
@@ -63,6 +61,9 @@ const AbilityResource* AbilityLibrary::load(AbilityId id) {
         "AbilityLibrary::load: Failed to load ability resource with id: ", id,
         "!");
 
+    prepare(res->onBegin);
+    prepare(res->onTick);
+    prepare(res->onEnd);
     return res;
   });
 }
@@ -73,21 +74,23 @@ const AbilityResource* AbilityLibrary::get(AbilityId id) const {
   return slots_.get(id);
 }
 
-void AbilityLibrary::registerOp(AbilityOp op, AbilityOpFn fn) {
-  RL_ASSERT(op < AbilityOp::Count,
-            "AbilityLibrary::registerOp: Invalid ability operation!");
-  opFns_[static_cast<usize>(op)] = fn;
-}
+void AbilityLibrary::prepare(AbilityProgram& prog) {
+  if (!verifyAbilityProgram(prog)) {
+    RL_LOG_ERR("AbilityLibrary::prepare: Invalid program, dropping it.");
+    prog.code.clear();
+  }
 
-void AbilityLibrary::unregisterOp(AbilityOp op) {
-  RL_ASSERT(op < AbilityOp::Count,
-            "AbilityLibrary::registerOp: Invalid ability operation!");
-  opFns_[static_cast<usize>(op)] = nullptr;
-}
+  optimizeAbilityProgram(prog);
+  compileAbilityProgram(prog);
+  auto facts = computeAbilityProgramFacts(prog);
+
+  if (facts.ticks != prog.facts.ticks || facts.flags != prog.facts.flags ||
+      facts.hitboxTicks != prog.facts.hitboxTicks) {
+    RL_LOG_WARN(
+        "AbilityLibrary::prepare: Exported facts are stale, using the ones "
+        "computed at load time.");
+  }
 
-AbilityOpFn AbilityLibrary::op(AbilityOp op) const noexcept {
-  RL_ASSERT(op < AbilityOp::Count,
-            "AbilityLibrary::op: Invalid ability operation!");
-  return opFns_[static_cast<usize>(op)];
+  prog.facts = std::move(facts);
 }
 }  // namespace rl
\ No newline at end of file
@@ -33,15 +33,12 @@ class AbilityLibrary {
   void unload(AbilityId id);
   const AbilityResource* get(AbilityId id) const;
 
-  void registerOp(AbilityOp op, AbilityOpFn fn);
-  void unregisterOp(AbilityOp op);
-  AbilityOpFn op(AbilityOp op) const noexcept;
-
  private:
   ResourceSlots<AbilityTag, AbilityResource> slots_{};
-  std::array<AbilityOpFn, static_cast<usize>(AbilityOp::Count)> opFns_{};
 
   AbilityLibrary() = default;
+
+  static void prepare(AbilityProgram& prog);
 };
 }  // namespace rl
 
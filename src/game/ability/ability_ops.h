@@ -0,0 +1,117 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef GAME_ABILITY_ABILITY_OPS_H_
+#define GAME_ABILITY_ABILITY_OPS_H_
+
+#include "engine/common.h"
+#include "game/ability/ability_program.h"
+
+namespace rl {
+namespace internal {
+// Op handlers, shared by the interpreters and the batched runner. Each one
+// moves vm.pc itself and returns false to yield until the next tick, with
+// vm.sleepTimer armed when it yields to sleep. Side effects go through fx,
+// which applies them right away or buffers them:
+//
+//   void play(Char&, AnimTag);
+//   bool playing(Char&, AnimTag);
+//   void speed(Char&, f32);
+//   void spawnHitbox(Char&, AbilityVM&, const AbilityOperandsHitbox&, bool);
+//   void dash(Char&, const AbilityOperandsDash&);
+template <typename Fx>
+inline bool opNoOp(Char&, AbilityVM& vm, const AbilityCode&, Fx&) {
+  ++vm.pc;
+  return true;
+}
+
+template <typename Fx>
+inline bool opSleep(Char&, AbilityVM& vm, const AbilityCode& ins, Fx&) {
+  vm.sleepTimer = std::max(vm.sleepTimer, ins.operands.scalar.value);
+  ++vm.pc;
+  return vm.sleepTimer <= .0f;
+}
+
+template <typename Fx>
+inline bool opPlayAnim(Char& c, AbilityVM& vm, const AbilityCode& ins,
+                       Fx& fx) {
+  fx.play(c, ins.operands.anim.anim);
+  ++vm.pc;
+  return true;
+}
+
+template <typename Fx>
+inline bool opWaitAnim(Char& c, AbilityVM& vm, const AbilityCode& ins,
+                       Fx& fx) {
+  if (fx.playing(c, ins.operands.anim.anim)) return false;
+  ++vm.pc;
+  return true;
+}
+
+template <typename Fx>
+inline bool opSetAnimSpeed(Char& c, AbilityVM& vm, const AbilityCode& ins,
+                           Fx& fx) {
+  fx.speed(c, ins.operands.scalar.value);
+  ++vm.pc;
+  return true;
+}
+
+template <typename Fx>
+inline bool opSetGcd(Char&, AbilityVM& vm, const AbilityCode& ins, Fx&) {
+  vm.gcd = ins.operands.scalar.value;
+  ++vm.pc;
+  return true;
+}
+
+template <typename Fx>
+inline bool opSetCd(Char&, AbilityVM& vm, const AbilityCode& ins, Fx&) {
+  vm.cooldown = ins.operands.scalar.value;
+  ++vm.pc;
+  return true;
+}
+
+template <typename Fx>
+inline bool opDamage(Char&, AbilityVM& vm, const AbilityCode&, Fx&) {
+  // Case: damage is applied by the combat system from hitbox contacts.
+  ++vm.pc;
+  return true;
+}
+
+template <typename Fx>
+inline bool opSpawnHitbox(Char& c, AbilityVM& vm, const AbilityCode& ins,
+                          Fx& fx) {
+  fx.spawnHitbox(c, vm, ins.operands.hitbox, false);
+  ++vm.pc;
+  return true;
+}
+
+template <typename Fx>
+inline bool opSpawnStickyHitbox(Char& c, AbilityVM& vm,
+                                const AbilityCode& ins, Fx& fx) {
+  fx.spawnHitbox(c, vm, ins.operands.hitbox, true);
+  ++vm.pc;
+  return true;
+}
+
+template <typename Fx>
+inline bool opDash(Char& c, AbilityVM& vm, const AbilityCode& ins, Fx& fx) {
+  fx.dash(c, ins.operands.dash);
+  ++vm.pc;
+  return true;
+}
+}  // namespace internal
+}  // namespace rl
+
+#endif  // GAME_ABILITY_ABILITY_OPS_H_
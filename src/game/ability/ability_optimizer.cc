@@ -0,0 +1,149 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "ability_optimizer.h"
+////////////////////////////////////////////////////////////////////////////////
+
+#include "engine/core/frame.h"
+#include "engine/core/log.h"
+#include "game/ability/ability_program_utils.h"
+
+namespace rl {
+namespace internal {
+// Setters whose effect a directly following setter of the same op replaces.
+inline bool isOverwritingSetter(AbilityOp op) {
+  return op == AbilityOp::SetAnimSpeed || op == AbilityOp::SetGcd ||
+         op == AbilityOp::SetCd;
+}
+}  // namespace internal
+
+bool verifyAbilityProgram(const AbilityProgram& prog) {
+  if (prog.code.size() > std::numeric_limits<AbilityPC>::max()) {
+    RL_LOG_ERR("verifyAbilityProgram: Program has ", prog.code.size(),
+               " ops, more than its pc can address!");
+    return false;
+  }
+
+  for (usize pc = 0; pc < prog.code.size(); ++pc) {
+    const auto& ins = prog.code[pc];
+
+    if (ins.op >= AbilityOp::Count) {
+      RL_LOG_ERR("verifyAbilityProgram: Invalid op ",
+                 static_cast<u32>(ins.op), " at pc ", pc, "!");
+      return false;
+    }
+
+    switch (ins.op) {
+      using enum AbilityOp;
+
+      case PlayAnim:
+      case WaitAnim:
+        if (ins.payload.get<AnimTag>(0) == kInvalidAnimTag) {
+          RL_LOG_WARN("verifyAbilityProgram: No animation at pc ", pc, ".");
+        }
+        break;
+      case SetAnimSpeed:
+        if (ins.payload.get<f32>(0) <= .0f) {
+          RL_LOG_WARN("verifyAbilityProgram: Non-positive speed at pc ", pc,
+                      ".");
+        }
+        break;
+      default:
+        break;
+    }
+  }
+
+  return true;
+}
+
+void optimizeAbilityProgram(AbilityProgram& prog) {
+  std::vector<AbilityInstruction> out;
+  out.reserve(prog.code.size());
+
+  for (const auto& ins : prog.code) {
+    if (ins.op == AbilityOp::NoOp) continue;
+    if (ins.op == AbilityOp::Sleep && ins.payload.get<f32>(0) <= .0f) continue;
+
+    if (internal::isOverwritingSetter(ins.op) && !out.empty() &&
+        out.back().op == ins.op) {
+      out.back() = ins;
+      continue;
+    }
+
+    out.push_back(ins);
+
+    // Case: nothing after an end is reachable. It is kept, since unlike
+    // running out of code it leaves the hitbox alive.
+    if (ins.op == AbilityOp::End) break;
+  }
+
+  prog.code = std::move(out);
+}
+
+AbilityProgramFacts computeAbilityProgramFacts(const AbilityProgram& prog) {
+  AbilityProgramFacts facts{};
+  auto budget = kMaxOpsPerFrame;
+  std::vector<AnimTag> played{};
+
+  auto yield = [&](u32 ticks) {
+    facts.ticks += ticks;
+    budget = kMaxOpsPerFrame;
+  };
+
+  for (const auto& ins : prog.compiled) {
+    if (budget == 0) yield(1);
+    --budget;
+
+    switch (ins.op) {
+      using enum AbilityOp;
+
+      case Sleep:
+        if (ins.operands.scalar.value > .0f) {
+          yield(abilitySleepTicks(ins.operands.scalar.value, kFixedStep));
+        }
+        break;
+      case PlayAnim:
+        played.push_back(ins.operands.anim.anim);
+        break;
+      case WaitAnim:
+        facts.flags |= kAbilityFactFlagBitsAnimBound;
+
+        // Case: an animation this program played holds it at least a tick,
+        // and the wait runs again on the tick it passes.
+        if (std::find(played.begin(), played.end(), ins.operands.anim.anim) !=
+            played.end()) {
+          yield(1);
+          --budget;
+        }
+        break;
+      case SpawnHitbox:
+      case SpawnStickyHitbox:
+        facts.hitboxTicks.push_back(facts.ticks);
+        break;
+      case End:
+        return facts;
+      default:
+        break;
+    }
+  }
+
+  return facts;
+}
+}  // namespace rl
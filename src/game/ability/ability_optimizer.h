@@ -0,0 +1,37 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef GAME_ABILITY_ABILITY_OPTIMIZER_H_
+#define GAME_ABILITY_ABILITY_OPTIMIZER_H_
+
+#include "engine/common.h"
+#include "game/ability/ability_program.h"
+
+namespace rl {
+// Mirrors the rlres ability exporter, so resources built by an older
+// exporter get the same treatment at load time.
+
+// Checks that every op exists and every pc fits. False if prog cannot run.
+bool verifyAbilityProgram(const AbilityProgram& prog);
+
+// Rewrites prog.code: drops no-ops, zero-length sleeps and whatever follows
+// the first end, and keeps only the last of adjacent setters.
+void optimizeAbilityProgram(AbilityProgram& prog);
+
+// Walks prog.compiled the way the ability runner steps it.
+AbilityProgramFacts computeAbilityProgramFacts(const AbilityProgram& prog);
+}  // namespace rl
+
+#endif  // GAME_ABILITY_ABILITY_OPTIMIZER_H_
@@ -16,6 +16,7 @@
 #ifndef GAME_ABILITY_ABILITY_PROGRAM_H_
 #define GAME_ABILITY_ABILITY_PROGRAM_H_
 
+#include "engine/anim/anim_type.h"
 #include "engine/common.h"
 #include "engine/core/frame.h"
 #include "engine/core/handle.h"
@@ -33,8 +34,62 @@ struct AbilityInstruction {
   AbilityPayload payload;
 };
 
+// Operands decoded once at load time, one layout per op family.
+struct AbilityOperandsAnim {
+  AnimTag anim{kInvalidAnimTag};
+};
+
+struct AbilityOperandsScalar {
+  f32 value{.0f};
+};
+
+struct AbilityOperandsDash {
+  f32 speed{.0f};
+  f32 duration{.0f};
+};
+
+struct AbilityOperandsHitbox {
+  CollisionFlags category{0};
+  CollisionFlags mask{0};
+  f32 duration{.0f};
+};
+
+union AbilityOperands {
+  AbilityOperandsAnim anim;
+  AbilityOperandsScalar scalar;
+  AbilityOperandsDash dash;
+  AbilityOperandsHitbox hitbox{};
+};
+
+// Pre-decoded instruction. Handler is the interpreter label of the op when
+// the VM is direct-threaded, null otherwise.
+struct AbilityCode {
+  const void* handler{nullptr};
+  AbilityOp op{AbilityOp::NoOp};
+  AbilityOperands operands{};
+};
+
+using AbilityFactFlags = u8;
+
+enum AbilityFactFlagBits : AbilityFactFlags {
+  kAbilityFactFlagBitsNone = 0x0,
+  // Waits on an animation, so ticks is a lower bound.
+  kAbilityFactFlagBitsAnimBound = 0x1,
+  kAbilityFactFlagBitsAll = static_cast<AbilityFactFlags>(-1),
+};
+
+// What can be told about a program without running it, in fixed ticks from
+// the one it starts on.
+struct AbilityProgramFacts {
+  u32 ticks{0};
+  AbilityFactFlags flags{kAbilityFactFlagBitsNone};
+  std::vector<u32> hitboxTicks{};
+};
+
 struct AbilityProgram {
-  std::vector<AbilityInstruction> code;
+  std::vector<AbilityInstruction> code;  // As authored.
+  std::vector<AbilityCode> compiled;     // What the VM runs.
+  AbilityProgramFacts facts{};
 };
 
 constexpr usize kMaxOpsPerFrame = 16;
@@ -62,9 +117,6 @@ struct AbilityVM {
   f32 gcd{0};
   HitboxHandle hitbox{kInvalidHandle};
 };
-
-using AbilityOpFn = bool (*)(Char&, AbilityVM&, const AbilityPayload&,
-                             const FramePacket&);
 }  // namespace rl
 
 #endif  // GAME_ABILITY_ABILITY_PROGRAM_H_
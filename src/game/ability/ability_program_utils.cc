@@ -25,8 +25,8 @@
 #include "engine/physics/hitbox_system.h"
 #include "engine/physics/physics_system.h"
 #include "engine/physics/physics_utils.h"
+#include "engine/time/time_system.h"
 #include "game/ability/ability.h"
-#include "game/ability/ability_library.h"
 
 namespace rl {
 const HitShapeByDir* resolveShape(Char& c) {
@@ -54,34 +54,30 @@ void destroyHitbox(AbilityVM& vm) {
   }
 }
 
-bool programStep(Char& c, AbilityVM& vm, const AbilityProgram& prog,
-                 const FramePacket& f) {
-  tickHitbox(c, vm);
-  auto step = static_cast<f32>(f.step);
+HitboxHandle spawnAbilityHitbox(Char& c, const AbilityOperandsHitbox& hb,
+                                bool sticky) {
+  // WIP Code.
+  const auto* shape = resolveShape(c);
+  auto endTime =
+      sticky ? .0 : RL_CTIMESYS.now() + static_cast<f64>(hb.duration);
 
-  if (vm.sleepTimer > .0f) {
-    vm.sleepTimer = std::max(.0f, vm.sleepTimer - step);
-    return false;
-  }
-
-  auto budget = kMaxOpsPerFrame;
-  const auto& code = prog.code;
-
-  while (budget-- > 0 && vm.pc < code.size()) {
-    const auto& ins = code[vm.pc];
-    auto fn = RL_ABILITYLIB.op(ins.op);
-    auto ended = true;
-    if (fn) ended = fn(c, vm, ins.payload, f);
-    if (ins.op == AbilityOp::End) return true;
-    if (ended) vm.pc++;
-
-    if (vm.sleepTimer > .0f) {
-      return false;
-    }
-  }
-
-  auto finished = (vm.pc >= code.size());
-  if (finished) destroyHitbox(vm);
-  return finished;
+  return RL_HITBOXSYS.generate({
+      .active = true,
+      // Carried along by dashes.
+      .fast = true,
+      .filter =
+          {
+              .category = hb.category,
+              .mask = hb.mask,
+          },
+      .maxHitCount = kInvalidCollisionHitCount,
+      .collider = shape->collider,
+      .endTime = endTime,
+      .ref =
+          {
+              .type = SpatialRefType::Transform,
+              .trans = c.trans,
+          },
+  });
 }
 }  // namespace rl
\ No newline at end of file
@@ -17,7 +17,6 @@
 #define GAME_ABILITY_ABILITY_PROGRAM_UTILS_H_
 
 #include "engine/common.h"
-#include "engine/core/frame.h"
 #include "game/ability/ability_program.h"
 #include "game/ability/ability_resource.h"
 #include "game/ability/ability_runtime.h"
@@ -56,11 +55,26 @@ inline void programStage(AbilityInst& inst) {
   }
 }
 
+// A sleeper resumes on the tick after its timer runs out.
+inline u32 abilitySleepTicks(f32 seconds, f64 step) {
+  constexpr f64 kEpsilon = 1e-4;
+  auto ticks = std::ceil(static_cast<f64>(seconds) / step - kEpsilon);
+  return static_cast<u32>(std::max(.0, ticks)) + 1;
+}
+
+// Each stage is picked up by the FSM on the tick after the previous one is
+// done.
+inline u32 abilityTicks(const AbilityResource& res) {
+  return res.onBegin.facts.ticks + res.onTick.facts.ticks +
+         res.onEnd.facts.ticks + 2;
+}
+
 const HitShapeByDir* resolveShape(Char& c);
 void tickHitbox(Char& c, AbilityVM& vm);
 void destroyHitbox(AbilityVM& vm);
-bool programStep(Char& c, AbilityVM& vm, const AbilityProgram& prog,
-                 const FramePacket& f);
+// A sticky hitbox lives until it is destroyed.
+HitboxHandle spawnAbilityHitbox(Char& c, const AbilityOperandsHitbox& hb,
+                                bool sticky);
 }  // namespace rl
 
 #endif  // GAME_ABILITY_ABILITY_PROGRAM_UTILS_H_
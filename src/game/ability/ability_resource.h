@@ -25,7 +25,7 @@ namespace rl {
 using AbilityId = ResourceId<AbilityTag>;
 
 struct AbilityResource {
-  inline constexpr static ResourceVersion kVersion{1};
+  inline constexpr static ResourceVersion kVersion{2};
 
   AbilityId id{kInvalidResourceId};
   AbilityCost cost{};
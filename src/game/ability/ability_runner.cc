@@ -0,0 +1,377 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "ability_runner.h"
+////////////////////////////////////////////////////////////////////////////////
+
+#include "engine/core/log.h"
+#include "engine/core/vector.h"
+#include "engine/physics/physics_system.h"
+#include "engine/relevance/relevance_system.h"
+#include "game/ability/ability_ops.h"
+#include "game/ability/ability_program_utils.h"
+
+namespace rl {
+namespace internal {
+// Lanes past the end of their program sort after every op.
+constexpr usize kAbilityLaneFinished = static_cast<usize>(AbilityOp::Count);
+
+inline usize laneKey(const AbilityVM& vm, const AbilityProgram& prog) {
+  if (vm.pc >= prog.compiled.size()) return kAbilityLaneFinished;
+  return static_cast<usize>(prog.compiled[vm.pc].op);
+}
+
+inline bool isLaterWake(Frame aTick, u32 aIndex, Frame bTick, u32 bIndex) {
+  return aTick != bTick ? aTick > bTick : aIndex > bIndex;
+}
+}  // namespace internal
+
+AbilityRunner& AbilityRunner::instance() {
+  static AbilityRunner inst;
+  return inst;
+}
+
+void AbilityRunner::init() {
+  RL_LOG_DEBUG("AbilityRunner::init");
+  constexpr auto kRunnerCapacity = 64;
+  tick_ = 0;
+  stats_ = {};
+  entries_.clear();
+  entries_.reserve(kRunnerCapacity);
+  active_.clear();
+  active_.reserve(kRunnerCapacity);
+  wakes_.clear();
+  wakes_.reserve(kRunnerCapacity);
+}
+
+void AbilityRunner::shutdown() {
+  RL_LOG_DEBUG("AbilityRunner::shutdown");
+  entries_.clear();
+  active_.clear();
+  wakes_.clear();
+  lanes_.clear();
+  sorted_.clear();
+  animCmds_.clear();
+  hitboxCmds_.clear();
+  dashCmds_.clear();
+  hitboxEnds_.clear();
+  stats_ = {};
+}
+
+void AbilityRunner::save(SnapshotWriter& w) const {
+  w.write(tick_);
+  w.write(entries_);
+  w.write(active_);
+  w.write(wakes_);
+  w.write(stats_.sleeping);
+}
+
+bool AbilityRunner::restore(SnapshotReader& r) {
+  return r.read(tick_) && r.read(entries_) && r.read(active_) &&
+         r.read(wakes_) && r.read(stats_.sleeping);
+}
+
+void AbilityRunner::start(CharHandle h) {
+  RL_ASSERT(h, "AbilityRunner::start: Invalid character handle provided!");
+  if (!h) return;
+  ensureCapacity(entries_, h.index);
+  auto& e = entries_[h.index];
+  e.handle = h;
+  ++e.serial;
+  if (e.state == AbilityRunState::Active) return;
+  deactivate(h.index);
+  activate(h.index);
+}
+
+void AbilityRunner::stop(CharHandle h) {
+  if (!h || h.index >= entries_.size()) return;
+  auto& e = entries_[h.index];
+  if (e.handle != h) return;
+  deactivate(h.index);
+  ++e.serial;
+}
+
+void AbilityRunner::tick(std::span<Char> chars, const FramePacket& f) {
+  ++tick_;
+  stats_.ops = 0;
+
+  // Wake the sleepers that are due, in tick order.
+  auto later = [](const Wake& a, const Wake& b) {
+    return internal::isLaterWake(a.tick, a.index, b.tick, b.index);
+  };
+
+  while (!wakes_.empty() && wakes_.front().tick <= tick_) {
+    std::pop_heap(wakes_.begin(), wakes_.end(), later);
+    auto w = wakes_.back();
+    wakes_.pop_back();
+    const auto& e = entries_[w.index];
+
+    // Case: stopped or restarted since it went to sleep.
+    if (e.state != AbilityRunState::Sleeping || e.serial != w.serial) {
+      continue;
+    }
+
+    deactivate(w.index);
+    activate(w.index);
+  }
+
+  lanes_.clear();
+  done_.clear();
+
+  for (auto index : active_) {
+    const auto& e = entries_[index];
+    auto* c = index < chars.size() ? &chars[index] : nullptr;
+    auto s = c ? c->abilities.activeSlot : kInvalidAbilitySlot;
+
+    if (!c || c->handle != e.handle || s == kInvalidAbilitySlot) {
+      done_.push_back(index);
+      continue;
+    }
+
+    // Case: the character is not ticked this tick, so neither is its ability:
+    // it stays active for the next one that is.
+    if (!RL_CRELEVSYS.shouldTick(c->relevance)) continue;
+    auto& inst = c->abilities.inst[s];
+    const auto* res = c->abilities.slots[s];
+    inst.vm.sleepTimer = .0f;
+
+    lanes_.push_back({
+        .c = c,
+        .vm = &inst.vm,
+        .prog = res ? resolveProgram(res, inst.stage) : nullptr,
+        .index = index,
+        .stride = std::max<u32>(
+            relevanceStride(RL_CRELEVSYS.tier(c->relevance)), 1),
+    });
+  }
+
+  for (auto index : done_) deactivate(index);
+  stats_.active = lanes_.size();
+
+  // One op per lane per round, lanes bucketed by the op they are at so each
+  // op runs as one loop. Lanes that yield, sleep or end drop out.
+  for (usize round = 0; round < kMaxOpsPerFrame && !lanes_.empty(); ++round) {
+    constexpr auto kKeyCount = internal::kAbilityLaneFinished + 1;
+    std::array<u32, kKeyCount + 1> offsets{};
+
+    for (const auto& l : lanes_) {
+      auto key = l.prog ? internal::laneKey(*l.vm, *l.prog)
+                        : static_cast<usize>(AbilityOp::End);
+      ++offsets[key + 1];
+    }
+
+    for (usize k = 0; k < kKeyCount; ++k) offsets[k + 1] += offsets[k];
+    auto cursors = offsets;
+    sorted_.resize(lanes_.size());
+
+    for (const auto& l : lanes_) {
+      auto key = l.prog ? internal::laneKey(*l.vm, *l.prog)
+                        : static_cast<usize>(AbilityOp::End);
+      sorted_[cursors[key]++] = l;
+    }
+
+    lanes_.clear();
+
+    for (usize k = 0; k < kKeyCount; ++k) {
+      if (offsets[k] == offsets[k + 1]) continue;
+      step(k,
+           std::span<Lane>{sorted_.data() + offsets[k],
+                           sorted_.data() + offsets[k + 1]},
+           f.step);
+    }
+  }
+
+  // Case: a program that ran out of budget on its last op is done anyway.
+  for (const auto& l : lanes_) {
+    if (l.vm->pc >= l.prog->compiled.size()) finish(l, true);
+  }
+
+  flush();
+}
+
+void AbilityRunner::activate(u32 index) {
+  auto& e = entries_[index];
+  e.state = AbilityRunState::Active;
+  e.slot = static_cast<u32>(active_.size());
+  active_.push_back(index);
+}
+
+void AbilityRunner::deactivate(u32 index) {
+  auto& e = entries_[index];
+
+  if (e.state == AbilityRunState::Active) {
+    auto last = active_.back();
+    active_[e.slot] = last;
+    entries_[last].slot = e.slot;
+    active_.pop_back();
+  } else if (e.state == AbilityRunState::Sleeping) {
+    --stats_.sleeping;
+  }
+
+  e.state = AbilityRunState::Idle;
+}
+
+void AbilityRunner::sleep(u32 index, f32 seconds, f64 step, u32 stride) {
+  deactivate(index);
+  auto& e = entries_[index];
+  e.state = AbilityRunState::Sleeping;
+
+  // Case: a reduced character counts the sleep in its own, longer steps, as
+  // its FSM does.
+  e.wake = tick_ + abilitySleepTicks(seconds, step * stride) * stride;
+
+  ++stats_.sleeping;
+  wakes_.push_back({e.wake, index, e.serial});
+  std::push_heap(wakes_.begin(), wakes_.end(),
+                 [](const Wake& a, const Wake& b) {
+                   return internal::isLaterWake(a.tick, a.index, b.tick,
+                                                b.index);
+                 });
+}
+
+void AbilityRunner::finish(const Lane& lane, bool destroyHitbox) {
+  lane.vm->running = false;
+  deactivate(lane.index);
+  if (destroyHitbox) hitboxEnds_.push_back(lane.vm);
+}
+
+void AbilityRunner::step(usize key, std::span<Lane> lanes, f64 step) {
+  stats_.ops += lanes.size();
+
+  if (key == internal::kAbilityLaneFinished) {
+    for (const auto& l : lanes) finish(l, true);
+    return;
+  }
+
+  switch (static_cast<AbilityOp>(key)) {
+    using enum AbilityOp;
+
+    case NoOp:
+      each<internal::opNoOp<Fx>>(lanes, step);
+      break;
+    case Sleep:
+      each<internal::opSleep<Fx>>(lanes, step);
+      break;
+    case PlayAnim:
+      each<internal::opPlayAnim<Fx>>(lanes, step);
+      break;
+    case WaitAnim:
+      each<internal::opWaitAnim<Fx>>(lanes, step);
+      break;
+    case SetAnimSpeed:
+      each<internal::opSetAnimSpeed<Fx>>(lanes, step);
+      break;
+    case SetGcd:
+      each<internal::opSetGcd<Fx>>(lanes, step);
+      break;
+    case SetCd:
+      each<internal::opSetCd<Fx>>(lanes, step);
+      break;
+    case Damage:
+      each<internal::opDamage<Fx>>(lanes, step);
+      break;
+    case SpawnHitbox:
+      each<internal::opSpawnHitbox<Fx>>(lanes, step);
+      break;
+    case SpawnStickyHitbox:
+      each<internal::opSpawnStickyHitbox<Fx>>(lanes, step);
+      break;
+    case Dash:
+      each<internal::opDash<Fx>>(lanes, step);
+      break;
+    case End:
+    default:
+      for (const auto& l : lanes) finish(l, false);
+      break;
+  }
+}
+
+template <AbilityRunner::OpFn Op>
+void AbilityRunner::each(std::span<Lane> lanes, f64 step) {
+  for (auto& l : lanes) {
+    Fx fx{*this, l};
+
+    if (Op(*l.c, *l.vm, l.prog->compiled[l.vm->pc], fx)) {
+      lanes_.push_back(l);
+      continue;
+    }
+
+    // Case: a yield with the timer armed is a sleep, any other one waits for
+    // the next tick (timers are cleared when lanes are gathered).
+    if (l.vm->sleepTimer > .0f) {
+      sleep(l.index, l.vm->sleepTimer, step, l.stride);
+    }
+  }
+}
+
+void AbilityRunner::Fx::play(Char& c, AnimTag tag) {
+  lane.played = tag;
+  runner.animCmds_.push_back({.c = &c, .tag = tag, .play = true});
+}
+
+bool AbilityRunner::Fx::playing(Char& c, AnimTag tag) {
+  // Case: an anim played this tick is not applied yet, but is playing.
+  return lane.played == tag || c.anim.playing(tag);
+}
+
+void AbilityRunner::Fx::speed(Char& c, f32 speed) {
+  runner.animCmds_.push_back({.c = &c, .speed = speed});
+}
+
+void AbilityRunner::Fx::spawnHitbox(Char& c, AbilityVM& vm,
+                                    const AbilityOperandsHitbox& hb,
+                                    bool sticky) {
+  runner.hitboxCmds_.push_back({
+      .c = &c,
+      .vm = &vm,
+      .hitbox = hb,
+      .sticky = sticky,
+  });
+}
+
+void AbilityRunner::Fx::dash(Char& c, const AbilityOperandsDash& d) {
+  runner.dashCmds_.push_back({c.body, d});
+}
+
+void AbilityRunner::flush() {
+  for (const auto& cmd : animCmds_) {
+    if (cmd.play) {
+      cmd.c->anim.play(cmd.tag);
+    } else {
+      cmd.c->anim.speed(cmd.speed);
+    }
+  }
+
+  for (const auto& cmd : hitboxCmds_) {
+    cmd.vm->hitbox = spawnAbilityHitbox(*cmd.c, cmd.hitbox, cmd.sticky);
+  }
+
+  for (const auto& cmd : dashCmds_) {
+    RL_PHYSICSSYS.dash(cmd.body, cmd.dash.speed, cmd.dash.duration);
+  }
+
+  for (auto* vm : hitboxEnds_) destroyHitbox(*vm);
+
+  animCmds_.clear();
+  hitboxCmds_.clear();
+  dashCmds_.clear();
+  hitboxEnds_.clear();
+}
+}  // namespace rl
@@ -0,0 +1,148 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef GAME_ABILITY_ABILITY_RUNNER_H_
+#define GAME_ABILITY_ABILITY_RUNNER_H_
+
+#include "engine/anim/anim_type.h"
+#include "engine/common.h"
+#include "engine/core/frame.h"
+#include "engine/snapshot/snapshot.h"
+#include "game/ability/ability_program.h"
+#include "game/character/character.h"
+
+namespace rl {
+enum class AbilityRunState : u8 { Idle, Active, Sleeping };
+
+struct AbilityRunnerStats {
+  usize active{0};
+  usize sleeping{0};
+  usize ops{0};
+};
+
+// Steps the VM of every character that runs an ability stage, all at once
+// after the character FSMs. Only VMs with work this tick are touched:
+// sleepers wait in a wake queue, and runnable VMs are stepped one op at a
+// time, grouped by op. Side effects are buffered and applied afterwards.
+// A stage that is done clears vm.running for the FSM to pick up. Characters
+// the relevance system skips this tick are skipped too, and reduced ones
+// sleep in strides of their longer step.
+class AbilityRunner {
+ public:
+  static AbilityRunner& instance();
+
+  void init();
+  void shutdown();
+
+  void save(SnapshotWriter& w) const;
+  bool restore(SnapshotReader& r);
+
+  void start(CharHandle h);
+  void stop(CharHandle h);
+  void tick(std::span<Char> chars, const FramePacket& f);
+
+  const AbilityRunnerStats& stats() const noexcept { return stats_; }
+
+ private:
+  struct Entry {
+    CharHandle handle{kInvalidHandle};
+    AbilityRunState state{AbilityRunState::Idle};
+    u32 slot{0};  // In active_ when active.
+    Frame wake{0};
+    u32 serial{0};
+  };
+
+  struct Wake {
+    Frame tick{0};
+    u32 index{0};
+    u32 serial{0};
+  };
+
+  struct Lane {
+    Char* c{nullptr};
+    AbilityVM* vm{nullptr};
+    const AbilityProgram* prog{nullptr};
+    AnimTag played{kInvalidAnimTag};
+    u32 index{0};
+    u32 stride{1};  // Fixed ticks per tick of the character.
+  };
+
+  struct AnimCmd {
+    Char* c{nullptr};
+    AnimTag tag{kInvalidAnimTag};
+    f32 speed{.0f};
+    bool play{false};
+  };
+
+  struct HitboxCmd {
+    Char* c{nullptr};
+    AbilityVM* vm{nullptr};
+    AbilityOperandsHitbox hitbox{};
+    bool sticky{false};
+  };
+
+  struct DashCmd {
+    PhysicsBodyHandle body{kInvalidHandle};
+    AbilityOperandsDash dash{};
+  };
+
+  // Side effects of the shared op handlers, buffered for flush().
+  struct Fx {
+    AbilityRunner& runner;
+    Lane& lane;
+
+    void play(Char& c, AnimTag tag);
+    bool playing(Char& c, AnimTag tag);
+    void speed(Char& c, f32 speed);
+    void spawnHitbox(Char& c, AbilityVM& vm, const AbilityOperandsHitbox& hb,
+                     bool sticky);
+    void dash(Char& c, const AbilityOperandsDash& d);
+  };
+
+  using OpFn = bool (*)(Char&, AbilityVM&, const AbilityCode&, Fx&);
+
+  Frame tick_{0};
+  std::vector<Entry> entries_{};
+  std::vector<u32> active_{};
+  std::vector<Wake> wakes_{};  // Min-heap on tick.
+  AbilityRunnerStats stats_{};
+
+  // Per-tick scratch.
+  std::vector<Lane> lanes_{};
+  std::vector<Lane> sorted_{};
+  std::vector<AnimCmd> animCmds_{};
+  std::vector<HitboxCmd> hitboxCmds_{};
+  std::vector<DashCmd> dashCmds_{};
+  std::vector<AbilityVM*> hitboxEnds_{};
+  std::vector<u32> done_{};
+
+  AbilityRunner() = default;
+
+  void activate(u32 index);
+  void deactivate(u32 index);
+  void sleep(u32 index, f32 seconds, f64 step, u32 stride);
+  void finish(const Lane& lane, bool destroyHitbox);
+  void step(usize key, std::span<Lane> lanes, f64 step);
+  template <OpFn Op>
+  void each(std::span<Lane> lanes, f64 step);
+  void flush();
+};
+}  // namespace rl
+
+#define RL_ABILITYRUNNER (::rl::AbilityRunner::instance())
+#define RL_CABILITYRUNNER \
+  (static_cast<const ::rl::AbilityRunner&>(::rl::AbilityRunner::instance()))
+
+#endif  // GAME_ABILITY_ABILITY_RUNNER_H_
@@ -39,6 +39,10 @@ void writeAbilityProgram(std::ostream& os, const AbilityProgram& prog) {
                     writePod(os, op);
                     writeAbilityPayload(os, inst.payload);
                   });
+
+  writePod(os, prog.facts.ticks);
+  writePod(os, prog.facts.flags);
+  writeVector(os, prog.facts.hitboxTicks);
 }
 
 void readAbilityProgram(std::istream& is, AbilityProgram& prog) {
@@ -48,6 +52,10 @@ void readAbilityProgram(std::istream& is, AbilityProgram& prog) {
     inst.op = static_cast<AbilityOp>(op);
     readAbilityPayload(is, inst.payload);
   });
+
+  readPod(is, prog.facts.ticks);
+  readPod(is, prog.facts.flags);
+  readVector(is, prog.facts.hitboxTicks);
 }
 
 void writeAbilityResource(std::ostream& os, const AbilityResource& r) {
@@ -0,0 +1,234 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "ability_vm.h"
+////////////////////////////////////////////////////////////////////////////////
+
+#include "engine/physics/physics_system.h"
+#include "game/ability/ability_ops.h"
+#include "game/ability/ability_program_utils.h"
+#include "game/character/character.h"
+
+namespace rl {
+namespace internal {
+// Applies side effects as the ops run.
+struct AbilityDirectFx {
+  void play(Char& c, AnimTag tag) { c.anim.play(tag); }
+  bool playing(Char& c, AnimTag tag) { return c.anim.playing(tag); }
+  void speed(Char& c, f32 speed) { c.anim.speed(speed); }
+
+  void spawnHitbox(Char& c, AbilityVM& vm, const AbilityOperandsHitbox& hb,
+                   bool sticky) {
+    vm.hitbox = spawnAbilityHitbox(c, hb, sticky);
+  }
+
+  void dash(Char& c, const AbilityOperandsDash& d) {
+    RL_PHYSICSSYS.dash(c.body, d.speed, d.duration);
+  }
+};
+
+// Label addresses only exist inside the interpreter, so called with a table
+// to fill it hands its dispatch table out instead of running.
+#ifdef RL_ABILITY_VM_THREADED
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif  // RL_ABILITY_VM_THREADED
+AbilityVMStatus execThreaded(Char* c, AbilityVM* vm, const AbilityProgram* prog,
+                             const void* const** table) {
+#ifdef RL_ABILITY_VM_THREADED
+  static const void* const kLabels[] = {
+      &&NoOp,   &&Sleep,  &&PlayAnim,    &&WaitAnim,
+      &&SetAnimSpeed,     &&SetGcd,      &&SetCd,
+      &&Damage, &&SpawnHitbox,           &&SpawnStickyHitbox,
+      &&Dash,   &&End,
+  };
+
+  static_assert(std::size(kLabels) == static_cast<usize>(AbilityOp::Count),
+                "Every ability op needs a label!");
+
+  if (table) {
+    *table = kLabels;
+    return AbilityVMStatus::Running;
+  }
+
+  const auto* code = prog->compiled.data();
+  auto size = prog->compiled.size();
+  auto budget = kMaxOpsPerFrame;
+  const AbilityCode* ins = nullptr;
+  AbilityDirectFx fx{};
+
+#define RL_ABILITY_DISPATCH()                       \
+  do {                                              \
+    if (budget-- == 0 || vm->pc >= size) goto Done; \
+    ins = &code[vm->pc];                            \
+    goto* ins->handler;                             \
+  } while (false)
+
+#define RL_ABILITY_OP(Name)                                          \
+  Name:                                                              \
+  if (!op##Name(*c, *vm, *ins, fx)) return AbilityVMStatus::Running; \
+  RL_ABILITY_DISPATCH()
+
+  RL_ABILITY_DISPATCH();
+  RL_ABILITY_OP(NoOp);
+  RL_ABILITY_OP(Sleep);
+  RL_ABILITY_OP(PlayAnim);
+  RL_ABILITY_OP(WaitAnim);
+  RL_ABILITY_OP(SetAnimSpeed);
+  RL_ABILITY_OP(SetGcd);
+  RL_ABILITY_OP(SetCd);
+  RL_ABILITY_OP(Damage);
+  RL_ABILITY_OP(SpawnHitbox);
+  RL_ABILITY_OP(SpawnStickyHitbox);
+  RL_ABILITY_OP(Dash);
+
+End:
+  return AbilityVMStatus::Ended;
+
+Done:
+  return vm->pc >= size ? AbilityVMStatus::Finished : AbilityVMStatus::Running;
+
+#undef RL_ABILITY_OP
+#undef RL_ABILITY_DISPATCH
+#else
+  if (table) *table = nullptr;
+  return c && vm && prog ? execAbilityProgramSwitch(*c, *vm, *prog)
+                         : AbilityVMStatus::Running;
+#endif  // RL_ABILITY_VM_THREADED
+}
+#ifdef RL_ABILITY_VM_THREADED
+#pragma GCC diagnostic pop
+#endif  // RL_ABILITY_VM_THREADED
+
+AbilityVMStatus execAbilityProgramSwitch(Char& c, AbilityVM& vm,
+                                         const AbilityProgram& prog) {
+  const auto& code = prog.compiled;
+  auto budget = kMaxOpsPerFrame;
+  AbilityDirectFx fx{};
+
+  while (budget-- > 0 && vm.pc < code.size()) {
+    const auto& ins = code[vm.pc];
+    auto next = true;
+
+    switch (ins.op) {
+      using enum AbilityOp;
+
+      case NoOp:
+        next = opNoOp(c, vm, ins, fx);
+        break;
+      case Sleep:
+        next = opSleep(c, vm, ins, fx);
+        break;
+      case PlayAnim:
+        next = opPlayAnim(c, vm, ins, fx);
+        break;
+      case WaitAnim:
+        next = opWaitAnim(c, vm, ins, fx);
+        break;
+      case SetAnimSpeed:
+        next = opSetAnimSpeed(c, vm, ins, fx);
+        break;
+      case SetGcd:
+        next = opSetGcd(c, vm, ins, fx);
+        break;
+      case SetCd:
+        next = opSetCd(c, vm, ins, fx);
+        break;
+      case Damage:
+        next = opDamage(c, vm, ins, fx);
+        break;
+      case SpawnHitbox:
+        next = opSpawnHitbox(c, vm, ins, fx);
+        break;
+      case SpawnStickyHitbox:
+        next = opSpawnStickyHitbox(c, vm, ins, fx);
+        break;
+      case Dash:
+        next = opDash(c, vm, ins, fx);
+        break;
+      case End:
+      default:
+        return AbilityVMStatus::Ended;
+    }
+
+    if (!next) return AbilityVMStatus::Running;
+  }
+
+  return vm.pc >= code.size() ? AbilityVMStatus::Finished
+                              : AbilityVMStatus::Running;
+}
+}  // namespace internal
+
+void compileAbilityProgram(AbilityProgram& prog) {
+  const void* const* labels = nullptr;
+  internal::execThreaded(nullptr, nullptr, nullptr, &labels);
+
+  prog.compiled.clear();
+  prog.compiled.reserve(prog.code.size());
+
+  for (const auto& ins : prog.code) {
+    RL_ASSERT(ins.op < AbilityOp::Count,
+              "compileAbilityProgram: Invalid ability operation!");
+    AbilityCode out{.op = ins.op};
+    const auto& p = ins.payload;
+
+    switch (ins.op) {
+      using enum AbilityOp;
+
+      case PlayAnim:
+      case WaitAnim:
+        out.operands.anim = {p.get<AnimTag>(0)};
+        break;
+      case Sleep:
+      case SetAnimSpeed:
+      case SetGcd:
+      case SetCd:
+      case Damage:
+        out.operands.scalar = {p.get<f32>(0)};
+        break;
+      case Dash:
+        out.operands.dash = {p.get<f32>(0), p.get<f32>(1)};
+        break;
+      case SpawnHitbox:
+      case SpawnStickyHitbox:
+        // Case: authored numbers are exported as f32.
+        out.operands.hitbox = {p.get<CollisionFlags>(0),
+                               p.get<CollisionFlags>(1), p.get<f32>(2)};
+        break;
+      case NoOp:
+      case End:
+      default:
+        break;
+    }
+
+    if (labels) out.handler = labels[static_cast<usize>(ins.op)];
+    prog.compiled.push_back(out);
+  }
+}
+
+AbilityVMStatus execAbilityProgram(Char& c, AbilityVM& vm,
+                                   const AbilityProgram& prog) {
+#ifdef RL_ABILITY_VM_THREADED
+  return internal::execThreaded(&c, &vm, &prog, nullptr);
+#else
+  return internal::execAbilityProgramSwitch(c, vm, prog);
+#endif  // RL_ABILITY_VM_THREADED
+}
+}  // namespace rl
@@ -0,0 +1,45 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef GAME_ABILITY_ABILITY_VM_H_
+#define GAME_ABILITY_ABILITY_VM_H_
+
+#include "engine/common.h"
+#include "game/ability/ability_program.h"
+
+// Computed goto is a GNU extension. Other compilers take the switch path.
+#if defined(__GNUC__) || defined(__clang__)
+#define RL_ABILITY_VM_THREADED
+#endif
+
+namespace rl {
+enum class AbilityVMStatus : u8 { Running, Finished, Ended };
+
+// Decodes the authored code of prog once, into prog.compiled.
+void compileAbilityProgram(AbilityProgram& prog);
+
+// Runs prog.compiled from vm.pc until it yields, runs out of code or spends
+// its op budget.
+AbilityVMStatus execAbilityProgram(Char& c, AbilityVM& vm,
+                                   const AbilityProgram& prog);
+
+namespace internal {
+// Portable dispatch, also what the threaded path is measured against.
+AbilityVMStatus execAbilityProgramSwitch(Char& c, AbilityVM& vm,
+                                         const AbilityProgram& prog);
+}  // namespace internal
+}  // namespace rl
+
+#endif  // GAME_ABILITY_ABILITY_VM_H_
@@ -22,6 +22,7 @@
 #include "engine/physics/collider_resource.h"
 #include "engine/physics/physics.h"
 #include "engine/physics/physics_body.h"
+#include "engine/relevance/relevance.h"
 #include "engine/resource/resource_type.h"
 #include "engine/transform/transform.h"
 #include "game/ability/ability_runtime.h"
@@ -79,6 +80,7 @@ struct Char {
   TransformHandle trans{kInvalidHandle};
   PhysicsBodyHandle body{kInvalidHandle};
   AnimColliderRigHandle animColRig{kInvalidHandle};
+  RelevanceHandle relevance{kInvalidHandle};
   CharAnims anim{};
   CharFsm fsm{};
   CharAbilities abilities{};
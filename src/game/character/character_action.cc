@@ -36,7 +36,6 @@ ActionScope scopeOf(const Char& c) {
 }
 
 Steering steeringFromActions(ActionScope scope) {
-  // TODO(m4jr0): AI.
   if (scope == kInvalidActionScope) return {};
   SteeringMask m = kSteeringMaskBitsNone;
   const auto& a = RL_ACTIONSYS;
@@ -51,4 +50,13 @@ Steering steeringFromActions(ActionScope scope) {
 
   return steeringFromMask(m);
 }
+
+Steering steeringOf(const Char& c) {
+  if (c.action.control == CharControlKind::Player) {
+    return steeringFromActions(c.action.data.player.scope);
+  }
+
+  if (c.action.control != CharControlKind::AI) return {};
+  return c.action.data.ai.steer;
+}
 }  // namespace rl
\ No newline at end of file
@@ -17,16 +17,21 @@
 #define GAME_CHARACTER_CHARACTER_ACTION_H_
 
 #include "engine/common.h"
+#include "engine/core/frame.h"
 #include "engine/input/action.h"
 #include "engine/physics/physics.h"
 #include "engine/player/player.h"
 #include "game/character/character_archetype.h"
+#include "game/path/flow_field.h"
 
 namespace rl {
 struct Char;
 
 enum class CharControlKind { Unknown = 0, Player, AI };
 
+// How urgently an AI needs to think, most urgent first.
+enum class CharAiTier : u8 { Combat = 0, Near, Visible, Far, Count };
+
 struct CharAction {
   CharControlKind control{CharControlKind::Unknown};
 
@@ -37,7 +42,11 @@ struct CharAction {
     } player;
 
     struct Ai {
-      // Future AI fields.
+      FlowFieldHandle flow;
+      // Decision of the last think, followed until the next one.
+      Steering steer{};
+      Frame thought{kInvalidFrame};  // Relevance tick count of the last think.
+      CharAiTier tier{CharAiTier::Far};
     } ai;
   } data;
 };
@@ -67,6 +76,8 @@ enum class CharInputAction : ActionTag {
 
 ActionScope scopeOf(const Char& c);
 Steering steeringFromActions(ActionScope scope);
+// Player input, or the last decision of an AI.
+Steering steeringOf(const Char& c);
 }  // namespace rl
 
 #endif  // GAME_CHARACTER_CHARACTER_ACTION_H_
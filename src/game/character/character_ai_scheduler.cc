@@ -0,0 +1,141 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "character_ai_scheduler.h"
+////////////////////////////////////////////////////////////////////////////////
+
+#include "engine/core/log.h"
+#include "engine/relevance/relevance_system.h"
+#include "engine/transform/transform_system.h"
+#include "game/path/flow_field_system.h"
+
+namespace rl {
+void CharAiScheduler::init(usize capacity) {
+  due_.clear();
+  due_.reserve(capacity);
+  stats_ = {};
+}
+
+void CharAiScheduler::shutdown() {
+  report();
+  due_.clear();
+}
+
+void CharAiScheduler::tick(std::vector<Char>& chars, const FramePacket&) {
+  due_.clear();
+  // Fixed ticks rather than frames: a frame runs any number of them, and the
+  // count is part of a snapshot, so a re-simulation waits the same.
+  auto now = RL_CRELEVSYS.tickCount();
+
+  for (const auto& c : chars) {
+    if (!c.handle || c.action.control != CharControlKind::AI) continue;
+    const auto& ai = c.action.data.ai;
+    // Case: an ability in flight is a fight, whatever the last think saw.
+    auto tier = c.abilities.activeSlot != kInvalidAbilitySlot
+                    ? CharAiTier::Combat
+                    : ai.tier;
+    auto interval = kIntervals_[static_cast<usize>(tier)];
+    auto first = ai.thought == kInvalidFrame;
+    auto waited = first ? interval : now - ai.thought;
+    if (!first && waited < interval) continue;
+    due_.push_back({c.handle.index, waited, interval, tier, first});
+  }
+
+  // Never thought first, then most overdue for its tier: a think left out
+  // keeps ageing until it passes the others, so no tier starves.
+  std::sort(due_.begin(), due_.end(), [](const Due& a, const Due& b) {
+    if (a.first != b.first) return a.first;
+    auto wa = a.waited * b.interval;
+    auto wb = b.waited * a.interval;
+    if (wa != wb) return wa > wb;
+    if (a.tier != b.tier) return a.tier < b.tier;
+    return a.index < b.index;
+  });
+
+  auto count = std::min(due_.size(), kThinkBudget_);
+  for (usize i = 0; i < count; ++i) think(chars[due_[i].index], due_[i], now);
+  stats_.deferred += due_.size() - count;
+}
+
+void CharAiScheduler::report() const {
+  constexpr std::array<const char*, kCharAiTierCount> kNames{
+      "combat", "near", "visible", "far"};
+
+  for (usize t = 0; t < kCharAiTierCount; ++t) {
+    const auto& s = stats_.tiers[t];
+    if (s.thinks == 0) continue;
+    auto thinks = static_cast<f64>(s.thinks);
+    auto each = s.seconds / thinks * 1e6;
+
+    if (s.rethinks == 0) {
+      RL_LOG_INFO("CharAiScheduler: ", kNames[t], ": ", s.thinks,
+                  " thinks, ", each, "us each.");
+      continue;
+    }
+
+    RL_LOG_INFO("CharAiScheduler: ", kNames[t], ": ", s.thinks, " thinks, ",
+                each, "us each, every ",
+                static_cast<f64>(s.waitedTicks) /
+                    static_cast<f64>(s.rethinks),
+                " ticks.");
+  }
+
+  RL_LOG_INFO("CharAiScheduler: ", stats_.deferred,
+              " thinks deferred by the budget.");
+}
+
+CharAiTier CharAiScheduler::tierOf(const Char& c, FlowCost cost) {
+  if (cost <= kCombatCost_) return CharAiTier::Combat;
+  if (cost <= kNearCost_) return CharAiTier::Near;
+
+  if (RL_CRELEVSYS.tier(c.relevance) == RelevanceTier::Full) {
+    return CharAiTier::Visible;
+  }
+
+  return CharAiTier::Far;
+}
+
+void CharAiScheduler::think(Char& c, const Due& d, Frame now) {
+  auto start = std::chrono::steady_clock::now();
+  auto& ai = c.action.data.ai;
+  const auto* g = RL_CTRANSSYS.global(c.trans);
+
+  if (g) {
+    ai.steer = RL_CFLOWFIELDSYS.steer(ai.flow, g->pos);
+    ai.tier = tierOf(c, RL_CFLOWFIELDSYS.cost(ai.flow, g->pos));
+  } else {
+    ai.steer = {};
+  }
+
+  ai.thought = now;
+  // Case: timings are for the stats only, never for decisions.
+  auto& s = stats_.tiers[static_cast<usize>(d.tier)];
+  ++s.thinks;
+
+  if (!d.first) {
+    ++s.rethinks;
+    s.waitedTicks += d.waited;
+  }
+
+  s.seconds += std::chrono::duration<f64>(std::chrono::steady_clock::now() -
+                                          start)
+                   .count();
+}
+}  // namespace rl
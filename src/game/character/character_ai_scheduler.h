@@ -0,0 +1,77 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef GAME_CHARACTER_CHARACTER_AI_SCHEDULER_H_
+#define GAME_CHARACTER_CHARACTER_AI_SCHEDULER_H_
+
+#include "engine/common.h"
+#include "engine/core/frame.h"
+#include "game/character/character.h"
+#include "game/character/character_action.h"
+
+namespace rl {
+inline constexpr auto kCharAiTierCount = static_cast<usize>(CharAiTier::Count);
+
+struct CharAiTierStats {
+  u64 thinks{0};
+  f64 seconds{.0};     // Spent thinking.
+  u64 rethinks{0};     // Thinks with a previous one, i.e. not the first.
+  u64 waitedTicks{0};  // Between a rethink and the previous think.
+};
+
+struct CharAiStats {
+  std::array<CharAiTierStats, kCharAiTierCount> tiers{};
+  u64 deferred{0};  // Due thinks pushed to a later tick by the budget.
+};
+
+// Spreads AI thinks across ticks: each tier has an interval, and a tick runs
+// at most a fixed number of the due thinks, most overdue first.
+class CharAiScheduler {
+ public:
+  void init(usize capacity);
+  void shutdown();
+
+  void tick(std::vector<Char>& chars, const FramePacket&);
+
+  const CharAiStats& stats() const noexcept { return stats_; }
+  void report() const;
+
+ private:
+  // The budget counts thinks rather than microseconds: rollback re-simulates
+  // ticks and needs them to make the same decisions as the first time.
+  inline static constexpr usize kThinkBudget_ = 64;
+  inline static constexpr std::array<Frame, kCharAiTierCount> kIntervals_{
+      1, 2, 4, 16};
+  // In flow field cells from the target.
+  inline static constexpr FlowCost kCombatCost_ = 2;
+  inline static constexpr FlowCost kNearCost_ = 8;
+
+  struct Due {
+    u32 index{0};
+    Frame waited{0};
+    Frame interval{1};
+    CharAiTier tier{CharAiTier::Far};
+    bool first{false};  // Never thought yet.
+  };
+
+  std::vector<Due> due_{};
+  CharAiStats stats_{};
+
+  static CharAiTier tierOf(const Char& c, FlowCost cost);
+  void think(Char& c, const Due& d, Frame now);
+};
+}  // namespace rl
+
+#endif  // GAME_CHARACTER_CHARACTER_AI_SCHEDULER_H_
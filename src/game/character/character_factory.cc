@@ -26,6 +26,7 @@
 #include "engine/core/value_utils.h"
 #include "engine/physics/hitbox.h"
 #include "engine/physics/physics_system.h"
+#include "engine/relevance/relevance_system.h"
 #include "engine/transform/transform.h"
 #include "engine/transform/transform_system.h"
 #include "game/ability/ability_library.h"
@@ -70,6 +71,7 @@ bool CharFactory::populate(Char& c, const CharDesc& desc) const {
 
   auto bodyDesc = arch->physics;
   bodyDesc.trans = c.trans;
+  bodyDesc.avoid = c.kind != CharKind::Player;
   c.body = RL_PHYSICSSYS.generate(bodyDesc);
   if (!almostZero(desc.pos)) RL_PHYSICSSYS.pos(c.body, desc.pos);
 
@@ -93,10 +95,19 @@ bool CharFactory::populate(Char& c, const CharDesc& desc) const {
     RL_ANIMSYS.play(c.anim.animator, arch->startAnim);
   }
 
+  c.relevance = RL_RELEVSYS.generate({
+      .flags = c.kind == CharKind::Player ? kRelevanceFlagBitsAnchor
+                                          : kRelevanceFlagBitsNone,
+      .trans = c.trans,
+      .animator = c.anim.animator,
+  });
+
   return true;
 }
 
 void CharFactory::unpopulate(Char& c) const {
+  if (c.relevance) RL_RELEVSYS.destroy(c.relevance);
+
   if (c.archetype) {
     const auto* arch = RL_CHARARCHLIB.get(c.archetype);
 
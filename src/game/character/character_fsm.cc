@@ -25,6 +25,7 @@
 #include "engine/input/action_system.h"
 #include "engine/physics/physics_system.h"
 #include "game/ability/ability_program_utils.h"
+#include "game/ability/ability_runner.h"
 #include "game/anim/anim_name_id.h"
 #include "game/character/character.h"
 #include "game/character/character_action.h"
@@ -49,8 +50,7 @@ bool tryStartAbility(Char& c) noexcept {
 }
 
 Steering handleMove(const Char& c, bool canMove) {
-  auto scope = scopeOf(c);
-  auto steer = canMove ? steeringFromActions(scope) : Steering{};
+  auto steer = canMove ? steeringOf(c) : Steering{};
   RL_PHYSICSSYS.steer(c.body, steer);
 
   if (!almostZero(steer)) {
@@ -60,25 +60,11 @@ Steering handleMove(const Char& c, bool canMove) {
   return steer;
 }
 
-void CharFsm::signal(CharStateEventId ev, Char& c) noexcept {
-  auto cur = current;
-
-  for (const auto& t : transitions) {
-    if (t.from == cur && t.ev == ev) {
-      if (states[cur].onExit) states[cur].onExit(c);
-      current = t.to;
-      if (states[t.to].onEnter) states[t.to].onEnter(c);
-      return;
-    }
-  }
-}
-
 void onEnterIdle(Char& c) noexcept { c.anim.play(kAnimIdIdle); }
 
 void onUpdateIdle(Char& c, const FramePacket&) noexcept {
-  auto scope = scopeOf(c);
   if (tryStartAbility(c)) return;
-  auto steer = steeringFromActions(scope);
+  auto steer = steeringOf(c);
 
   if (steer.x != .0f || steer.y != .0f) {
     c.fsm.signal(kCharStateEventStartMove, c);
@@ -120,6 +106,7 @@ void onEnterAbility(Char& c) noexcept {
   inst.vm = {};
   inst.vm.pc = 0;
   inst.vm.running = true;
+  RL_ABILITYRUNNER.start(c.handle);
 }
 
 void onUpdateAbility(Char& c, const FramePacket& f) noexcept {
@@ -138,18 +125,22 @@ void onUpdateAbility(Char& c, const FramePacket& f) noexcept {
     return;
   }
 
-  const auto* prog = resolveProgram(res, inst.stage);
-  auto ended = !prog || programStep(c, inst.vm, *prog, f);
+  // Case: the program itself is stepped by the ability runner, after every
+  // character has ticked.
+  tickHitbox(c, inst.vm);
   inst.t += static_cast<f32>(f.step);
   handleMove(c, !(res->flags & kAbilityFlagBitsLockMovement));
+  if (inst.vm.running) return;
+  programStage(inst);
 
-  if (ended) {
-    programStage(inst);
-
-    if (inst.stage == AbilityStage::Pending) {
-      c.fsm.signal(kCharStateEventAbilityDone, c);
-    }
+  if (inst.stage == AbilityStage::Pending) {
+    c.fsm.signal(kCharStateEventAbilityDone, c);
+    return;
   }
+
+  inst.vm.pc = 0;
+  inst.vm.running = true;
+  RL_ABILITYRUNNER.start(c.handle);
 }
 
 void onExitAbility(Char& c) noexcept {
@@ -159,6 +150,7 @@ void onExitAbility(Char& c) noexcept {
     return;
   }
 
+  RL_ABILITYRUNNER.stop(c.handle);
   auto& inst = c.abilities.inst[s];
   inst.flags &= ~kAbilityInstFlagBitsInUse;
   c.abilities.gcd = std::max(c.abilities.gcd, inst.vm.gcd);
@@ -18,16 +18,14 @@
 
 #include "engine/common.h"
 #include "engine/core/frame.h"
+#include "engine/core/fsm.h"
 #include "engine/physics/physics.h"
 
 namespace rl {
 struct Char;
 
-using CharStateId = u16;
-constexpr auto kInvalidCharStateId = static_cast<CharStateId>(-1);
-
-using CharStateEventId = u16;
-constexpr auto kInvalidCharStateEventId = static_cast<CharStateEventId>(-1);
+using CharStateId = StateId;
+using CharStateEventId = StateEventId;
 
 enum : CharStateId {
   kCharStateIdle = 0,
@@ -46,29 +44,9 @@ enum : CharStateEventId {
   kCharStateEventDeath,
 };
 
-struct CharState {
-  void (*onEnter)(Char&) noexcept {nullptr};
-  void (*onUpdate)(Char&, const FramePacket&) noexcept {nullptr};
-  void (*onExit)(Char&) noexcept {nullptr};
-};
-
-struct CharTransition {
-  CharStateId from{};
-  CharStateId to{};
-  CharStateEventId ev{};
-};
-
-struct CharFsm {
-  std::vector<CharState> states{};
-  std::vector<CharTransition> transitions{};
-  CharStateId current{0};
-
-  void signal(CharStateEventId ev, Char& c) noexcept;
-
-  void tick(Char& c, const FramePacket& f) noexcept {
-    if (states[current].onUpdate) states[current].onUpdate(c, f);
-  }
-};
+using CharFsm = Fsm<Char>;
+using CharFsmDef = FsmDef<Char>;
+using CharFsmBatch = FsmBatch<Char>;
 
 bool tryStartAbility(Char& c) noexcept;
 Steering handleMove(const Char& c, bool canMove);
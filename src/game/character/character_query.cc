@@ -0,0 +1,121 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "character_query.h"
+////////////////////////////////////////////////////////////////////////////////
+
+#include "engine/physics/physics_system.h"
+#include "game/character/character_system.h"
+#include "game/world/tile_query.h"
+#include "game/world/tile_system.h"
+
+namespace rl {
+namespace internal {
+template <typename Shape>
+usize charsIn(const Shape& s, std::span<CharHandle> out) {
+  usize count = 0;
+
+  RL_CPHYSICSSYS.overlaps(s, [&](PhysicsBodyHandle b) {
+    if (count == out.size()) return;
+    auto c = RL_CCHARSYS.owner(b);
+    if (c) out[count++] = c;
+  });
+
+  return count;
+}
+}  // namespace internal
+
+usize charsInCircle(const Circle& c, std::span<CharHandle> out) {
+  return internal::charsIn(c, out);
+}
+
+usize charsInBox(const Aabb& a, std::span<CharHandle> out) {
+  return internal::charsIn(a, out);
+}
+
+usize nearestChars(Position pos, Distance radius, std::span<CharHandle> out,
+                   CharHandle ignore) {
+  RL_ASSERT(out.size() <= kMaxNearestChars,
+            "nearestChars: Too many characters requested!");
+  auto k = std::min(out.size(), kMaxNearestChars);
+  std::array<f32, kMaxNearestChars> dists{};
+  usize count = 0;
+
+  auto r2 = radius * radius;
+
+  // Insertion into the sorted k best: k is small. Distances are cheaper than
+  // owners, so they go first.
+  RL_CPHYSICSSYS.candidates({pos, {radius, radius}}, [&](const PhysicsBody& b) {
+    auto d = (aabbOf(b.wCollider).center - pos).magSqrd();
+    if (k == 0 || d > r2 || (count == k && d >= dists[k - 1])) return;
+    auto c = RL_CCHARSYS.owner(b.handle);
+    if (!c || c == ignore) return;
+    auto i = std::min(count, k - 1);
+
+    for (; i > 0 && dists[i - 1] > d; --i) {
+      dists[i] = dists[i - 1];
+      out[i] = out[i - 1];
+    }
+
+    dists[i] = d;
+    out[i] = c;
+    count = std::min(count + 1, k);
+  });
+
+  return count;
+}
+
+bool raycast(const CharRayDesc& desc, CharRayHit& hit) {
+  hit = {};
+  auto to = desc.to;
+  const auto* set = desc.walls ? RL_CTILESYS.tileset(desc.walls) : nullptr;
+  TileRayHit wall{};
+  auto blocked = set && raycastTiles(*set, desc.from, desc.to, wall);
+
+  // Characters only count up to the wall.
+  if (blocked) to = wall.point;
+  BodyRayHit body{};
+
+  auto found = RL_CPHYSICSSYS.raycast(
+      desc.from, to, body, [&](PhysicsBodyHandle b) {
+        auto c = RL_CCHARSYS.owner(b);
+        return c && c != desc.ignore;
+      });
+
+  if (found) {
+    hit.character = RL_CCHARSYS.owner(body.body);
+    hit.t = blocked ? body.t * wall.t : body.t;
+    hit.point = body.point;
+    return true;
+  }
+
+  if (!blocked) return false;
+  hit.tile = wall.tile;
+  hit.t = wall.t;
+  hit.point = wall.point;
+  return true;
+}
+
+bool lineOfSight(TileSetHandle walls, Position from, Position to) {
+  const auto* set = RL_CTILESYS.tileset(walls);
+  TileRayHit hit{};
+  return !set || !raycastTiles(*set, from, to, hit);
+}
+}  // namespace rl
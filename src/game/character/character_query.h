@@ -0,0 +1,60 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef GAME_CHARACTER_CHARACTER_QUERY_H_
+#define GAME_CHARACTER_CHARACTER_QUERY_H_
+
+#include "engine/common.h"
+#include "engine/physics/collider.h"
+#include "engine/transform/transform.h"
+#include "game/character/character.h"
+#include "game/world/tile.h"
+#include "game/world/tile_set.h"
+
+// Perception queries: characters through the physics grid built this tick,
+// walls through the tile set. Results go into the caller's span, and the
+// functions return how many were written.
+namespace rl {
+constexpr usize kMaxNearestChars = 16;
+
+struct CharRayDesc {
+  Position from{};
+  Position to{};
+  TileSetHandle walls{kInvalidHandle};  // Optional: stops the ray at walls.
+  CharHandle ignore{kInvalidHandle};    // Usually the one looking.
+};
+
+struct CharRayHit {
+  CharHandle character{kInvalidHandle};  // Unset if a wall was hit first.
+  TileCoord tile{};                      // Set if a wall was hit.
+  f32 t{1.0f};                           // Along the segment, from 0 to 1.
+  Position point{};
+};
+
+usize charsInCircle(const Circle& c, std::span<CharHandle> out);
+usize charsInBox(const Aabb& a, std::span<CharHandle> out);
+// The out.size() characters whose centers are closest to pos within radius,
+// nearest first, at most kMaxNearestChars.
+usize nearestChars(Position pos, Distance radius, std::span<CharHandle> out,
+                   CharHandle ignore = kInvalidHandle);
+
+// Whether anything lies along the segment: hit says which of a wall or a
+// character came first.
+bool raycast(const CharRayDesc& desc, CharRayHit& hit);
+[[nodiscard]] bool lineOfSight(TileSetHandle walls, Position from,
+                               Position to);
+}  // namespace rl
+
+#endif  // GAME_CHARACTER_CHARACTER_QUERY_H_
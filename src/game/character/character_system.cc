@@ -25,8 +25,10 @@
 #include "engine/core/vector.h"
 #include "engine/physics/physics.h"
 #include "engine/physics/physics_system.h"
+#include "engine/relevance/relevance_system.h"
 #include "engine/render/render_submit.h"
 #include "engine/transform/transform_system.h"
+#include "game/ability/ability_runner.h"
 #include "game/character/character_factory.h"
 #include "game/character/character_utils.h"
 #include "game/render/game_render_common.h"
@@ -49,19 +51,76 @@ void CharSystem::init() {
   hCharPool_.reserve(kCharCapacity);
   chars_.reserve(kCharCapacity);
   stepHandler_.init(kCharCapacity);
+  aiScheduler_.init(kCharCapacity);
 }
 
 void CharSystem::shutdown() {
   RL_LOG_DEBUG("CharSystem::shutdown");
+  aiScheduler_.shutdown();
   stepHandler_.shutdown();
   hCharPool_.clear();
   chars_.clear();
+  owners_.clear();
   RL_CHARFACTORY.shutdown();
 }
 
+void CharSystem::save(SnapshotWriter& w) const {
+  hCharPool_.save(w);
+  w.write(static_cast<u32>(chars_.size()));
+
+  for (const auto& c : chars_) {
+    w.write(c.handle);
+    w.write(c.kind);
+    w.write(c.archetype);
+    w.write(c.action);
+    w.write(c.dir);
+    w.write(c.trans);
+    w.write(c.body);
+    w.write(c.animColRig);
+    w.write(c.relevance);
+    w.write(c.anim.animator);
+    w.write(c.anim.listenerIds);
+    w.write(c.fsm);
+    w.write(c.abilities);
+    w.write(c.collision);
+  }
+}
+
+bool CharSystem::restore(SnapshotReader& r) {
+  u32 count{0};
+  if (!hCharPool_.restore(r) || !r.read(count)) return false;
+  chars_.resize(count);
+
+  // Case: footstep listeners are presentation only and stay registered on the
+  // animators that survived the restore.
+  for (auto& c : chars_) {
+    if (!r.read(c.handle) || !r.read(c.kind) || !r.read(c.archetype) ||
+        !r.read(c.action) || !r.read(c.dir) || !r.read(c.trans) ||
+        !r.read(c.body) || !r.read(c.animColRig) || !r.read(c.relevance) ||
+        !r.read(c.anim.animator) || !r.read(c.anim.listenerIds) ||
+        !r.read(c.fsm) || !r.read(c.abilities) || !r.read(c.collision)) {
+      return false;
+    }
+  }
+
+  owners_.clear();
+
+  for (const auto& c : chars_) {
+    if (!c.handle || !c.body) continue;
+    ensureCapacity(owners_, c.body.index);
+    owners_[c.body.index] = c.handle;
+  }
+
+  return true;
+}
+
 void CharSystem::fixedUpdate(const FramePacket& f) {
+  aiScheduler_.tick(chars_, f);
+  fsmBatch_.clear();
+
   for (auto& c : chars_) {
     if (!c.handle) continue;
+    if (!RL_CRELEVSYS.shouldTick(c.relevance)) continue;
 
     if (c.body) {
       const auto* b = RL_CPHYSICSSYS.body(c.body);
@@ -70,8 +129,26 @@ void CharSystem::fixedUpdate(const FramePacket& f) {
       c.dir = CardinalDir::Unset;
     }
 
-    c.fsm.tick(c, f);
+    if (RL_CRELEVSYS.tier(c.relevance) == RelevanceTier::Full) {
+      fsmBatch_.add(c.fsm, c, f);
+      continue;
+    }
+
+    // Case: reduced characters tick less often, over a longer step.
+    FramePacket rf{
+        .frame = f.frame,
+        .lag = f.lag,
+        .delta = f.delta,
+        .step = RL_CRELEVSYS.step(c.relevance, f.step),
+        .time = f.time,
+        .alpha = f.alpha,
+    };
+
+    fsmBatch_.add(c.fsm, c, rf);
   }
+
+  fsmBatch_.tick();
+  RL_ABILITYRUNNER.tick(chars_, f);
 }
 
 void CharSystem::update(const FramePacket&) {
@@ -103,6 +180,12 @@ CharHandle CharSystem::generate(const CharDesc& desc) {
   c.handle = h;
   RL_CHARFACTORY.populate(c, desc);
   stepHandler_.on(c);
+
+  if (c.body) {
+    ensureCapacity(owners_, c.body.index);
+    owners_[c.body.index] = h;
+  }
+
   return h;
 }
 
@@ -110,6 +193,7 @@ void CharSystem::destroy(CharHandle h) {
   RL_ASSERT(h, "CharSystem::destroy: Invalid character handle provided!");
   if (!h) return;
   auto& c = chars_[h.index];
+  RL_ABILITYRUNNER.stop(h);
   stepHandler_.off(c);
   RL_CHARFACTORY.unpopulate(c);
   hCharPool_.destroy(h);
@@ -124,6 +208,14 @@ const Char* CharSystem::character(CharHandle h) const {
 
 bool CharSystem::exists(CharHandle h) const { return h && hCharPool_.alive(h); }
 
+CharHandle CharSystem::owner(PhysicsBodyHandle h) const {
+  if (!h || h.index >= owners_.size()) return kInvalidHandle;
+  auto c = owners_[h.index];
+  // Case: the body outlived its character, or was reused by another one.
+  if (!exists(c) || chars_[c.index].body != h) return kInvalidHandle;
+  return c;
+}
+
 Char* CharSystem::character(CharHandle h) {
   RL_ASSERT(h && hCharPool_.alive(h),
             "CharSystem::character: Invalid character handle provided!");
@@ -19,7 +19,9 @@
 #include "engine/common.h"
 #include "engine/core/frame.h"
 #include "engine/core/handle.h"
+#include "engine/snapshot/snapshot.h"
 #include "game/character/character.h"
+#include "game/character/character_ai_scheduler.h"
 #include "game/character/character_step_handler.h"
 
 namespace rl {
@@ -38,6 +40,9 @@ class CharSystem {
   void init();
   void shutdown();
 
+  void save(SnapshotWriter& w) const;
+  bool restore(SnapshotReader& r);
+
   void fixedUpdate(const FramePacket& f);
   void update(const FramePacket&);
 
@@ -46,6 +51,10 @@ class CharSystem {
 
   const Char* character(CharHandle h) const;
   bool exists(CharHandle h) const;
+  const CharAiStats& aiStats() const noexcept { return aiScheduler_.stats(); }
+  // Character moved by a physics body, if any: maps spatial query results
+  // back to characters.
+  CharHandle owner(PhysicsBodyHandle h) const;
 
 #ifdef RL_DEBUG
   void debugOn(CharSystemDebugFlags flags) { dFlags_ |= flags; }
@@ -58,7 +67,10 @@ class CharSystem {
 #endif  // RL_DEBUG
   HandlePool<CharTag> hCharPool_{};
   std::vector<Char> chars_{};
+  std::vector<CharHandle> owners_{};  // Per body index.
   CharacterStepHandler stepHandler_{};
+  CharAiScheduler aiScheduler_{};
+  CharFsmBatch fsmBatch_{};
 
   CharSystem() = default;
 
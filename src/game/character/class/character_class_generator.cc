@@ -28,35 +28,39 @@
 #include "engine/sound/sound_library.h"
 #include "engine/transform/transform_system.h"
 #include "game/character/class/character_class_default_bindings.h"
+#include "game/path/flow_field_system.h"
 
 namespace rl {
 namespace internal {
+const CharFsmDef& commonFsmDef() {
+  static const CharFsmDef def{{
+      .states =
+          {
+              {&onEnterIdle, &onUpdateIdle, nullptr},
+              {&onEnterMove, &onUpdateMove, &onExitMove},
+              {&onEnterAbility, &onUpdateAbility, &onExitAbility},
+              {},
+              {},
+          },
+      .transitions =
+          {
+              {kCharStateIdle, kCharStateMove, kCharStateEventStartMove},
+              {kCharStateMove, kCharStateIdle, kCharStateEventStopMove},
+              {kCharStateIdle, kCharStateAbilityRun,
+               kCharStateEventStartAbility},
+              {kCharStateMove, kCharStateAbilityRun,
+               kCharStateEventStartAbility},
+              {kCharStateAbilityRun, kCharStateIdle,
+               kCharStateEventAbilityDone},
+          },
+      .initial = kCharStateIdle,
+  }};
+
+  return def;
+}
+
 void generateFsmCommon(Char& c, const CharArchetypeResource*) {
-  c.fsm.states.clear();
-  c.fsm.states.resize(5);
-  c.fsm.states[kCharStateIdle] = {&onEnterIdle, &onUpdateIdle, nullptr};
-  c.fsm.states[kCharStateMove] = {&onEnterMove, &onUpdateMove, &onExitMove};
-  c.fsm.states[kCharStateAbilityRun] = {&onEnterAbility, &onUpdateAbility,
-                                        &onExitAbility};
-  c.fsm.states[kCharStateHurt] = {};
-  c.fsm.states[kCharStateDeath] = {};
-
-  auto& tr = c.fsm.transitions;
-  tr.clear();
-  tr.push_back({kCharStateIdle, kCharStateMove, kCharStateEventStartMove});
-  tr.push_back({kCharStateMove, kCharStateIdle, kCharStateEventStopMove});
-  tr.push_back(
-      {kCharStateIdle, kCharStateAbilityRun, kCharStateEventStartAbility});
-  tr.push_back(
-      {kCharStateMove, kCharStateAbilityRun, kCharStateEventStartAbility});
-  tr.push_back(
-      {kCharStateAbilityRun, kCharStateIdle, kCharStateEventAbilityDone});
-
-  c.fsm.current = kCharStateIdle;
-
-  if (c.fsm.states[kCharStateIdle].onEnter) {
-    c.fsm.states[kCharStateIdle].onEnter(c);
-  }
+  c.fsm.start(commonFsmDef(), c);
 }
 
 void generateAnimatorCommon(Char& c, const CharArchetypeResource* arch) {
@@ -102,8 +106,13 @@ void destroyAnimatorCommon(Char& c, const CharArchetypeResource*) {
 }
 
 void destroyInputCommon(Char& c, const CharArchetypeResource*) {
-  RL_ACTIONSYS.unset(c.action.data.player.scope);
+  if (c.action.control == CharControlKind::Player) {
+    RL_ACTIONSYS.unset(c.action.data.player.scope);
+  } else if (c.action.control == CharControlKind::AI) {
+    RL_FLOWFIELDSYS.release(c.action.data.ai.flow);
+  }
 }
+
 void destroySoundsCommon(Char&, const CharArchetypeResource* arch) {
   if (arch->soundBank) {
     RL_SOUNDLIB.unloadBank(arch->soundBank);
@@ -31,6 +31,7 @@
 #include "game/action_scope.h"
 #include "game/camera/player_camera_system.h"
 #include "game/character/character_system.h"
+#include "game/path/flow_field_system.h"
 #include "game/render/game_render_common.h"
 #include "game/world/tile_system.h"
 
@@ -151,13 +152,25 @@ void loadCharacters(DemoData& data) {
       .scale = {2.0f, 2.0f},
   });
 
+  // Chases the adventurer across the floor.
+  const auto* prey = RL_CCHARSYS.character(data.adventurer);
+
   data.beholder = RL_CHARSYS.generate({
       .kind = CharKind::Monster,
       .archetype = RL_CRESTAB.rid<CharArchetypeId>("chararch.beholder"),
       .action =
           {
               .control = CharControlKind::AI,
-              .data = {},
+              .data =
+                  {
+                      .ai =
+                          {
+                              .flow = RL_FLOWFIELDSYS.acquire({
+                                  .set = data.backgroundSet,
+                                  .target = prey->trans,
+                              }),
+                          },
+                  },
           },
       .pos = {256.0f, 50.0f},
       .scale = {3.0f, 3.0f},
@@ -223,5 +236,29 @@ void unloadDemo(DemoData& data) {
   unloadInteractiveTilesets(data);
   unloadBackgroundTilesets(data);
 }
+
+void demoRemoteInput(Frame tick, ActionFrame& out, void* userData) {
+  constexpr Frame kHoldTicks = 30;
+  constexpr u32 kAbilityOdds = 90;
+  const auto* data = static_cast<const DemoData*>(userData);
+
+  // Case: a pure function of the tick, so a resent or replayed tick always
+  // carries the same input.
+  Splitmix64 hold{data->seed ^ (tick / kHoldTicks) * 0x9e3779b97f4a7c15};
+  Splitmix64 press{data->seed + tick};
+  auto dirs = hold.next<u32>(0, 15);
+  auto key = [](CharInputAction a) {
+    return actionKey(kPlayer1Char, static_cast<ActionTag>(a));
+  };
+
+  if (dirs & 0x1) out.digital.push_back(key(CharInputAction::Up));
+  if (dirs & 0x2) out.digital.push_back(key(CharInputAction::Down));
+  if (dirs & 0x4) out.digital.push_back(key(CharInputAction::Left));
+  if (dirs & 0x8) out.digital.push_back(key(CharInputAction::Right));
+
+  if (press.next<u32>(0, kAbilityOdds - 1) == 0) {
+    out.digital.push_back(key(CharInputAction::Ability0));
+  }
+}
 }  // namespace internal
 }  // namespace rl
@@ -17,7 +17,9 @@
 #define ENGINE_GAME_DEMO_H_
 
 #include "engine/common.h"
+#include "engine/core/frame.h"
 #include "engine/core/handle.h"
+#include "engine/input/action.h"
 #include "engine/physics/anim_collider_sync.h"
 #include "engine/resource/resource_type.h"
 #include "engine/sound/sound.h"
@@ -57,6 +59,9 @@ void unloadBackgroundTilesets(DemoData& data);
 
 void loadDemo(DemoData& data);
 void unloadDemo(DemoData& data);
+
+// Seeded stand-in for the remote player of a headless rollback session.
+void demoRemoteInput(Frame tick, ActionFrame& out, void* userData);
 }  // namespace internal
 }  // namespace rl
 
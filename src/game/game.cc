@@ -26,34 +26,69 @@
 #include "engine/core/phase_bus.h"
 #include "engine/event/event_system.h"
 #include "engine/scene/scene_message.h"
+#include "engine/snapshot/snapshot_system.h"
 #include "game/ability/ability_library.h"
+#include "game/ability/ability_runner.h"
+#include "game/action_scope.h"
 #include "game/camera/player_camera_system.h"
 #include "game/character/character_archetype_library.h"
 #include "game/character/character_system.h"
 #include "game/combat/combat_system.h"
 #include "game/demo.h"
+#include "game/path/flow_field_system.h"
+#include "game/path/path_system.h"
 #include "game/physics/material_library.h"
 #include "game/physics/surface_system.h"
 #include "game/world/tile_system.h"
 
 namespace rl {
 static DemoData demo{};
+constexpr u64 kDemoSeed = 1231031;
 
 Game& Game::instance() {
   static Game inst;
   return inst;
 }
 
-void Game::run() {
+void Game::run(EngineDesc desc) {
+  if (desc.seed == 0) desc.seed = kDemoSeed;
+  desc.rollback.link.seed = desc.seed;
+  desc.rollback.remoteSlot = kPlayer1Slot;
+
+  if (desc.mode == EngineMode::Headless && !desc.rollback.remoteInput) {
+    desc.rollback.remoteInput = internal::demoRemoteInput;
+    desc.rollback.remoteUserData = &demo;
+  }
+
   RL_PHASEBUS.on(LifeCyclePhase::Init, [] {
     RL_MATERIALLIB.init();
     RL_SURFACESYS.init();
     RL_TILESYS.init();
+    RL_FLOWFIELDSYS.init();
+    RL_PATHSYS.init();
     RL_PLAYCAMSYS.init();
     RL_CHARSYS.init();
     RL_COMBATSYS.init();
 
+    RL_SNAPSHOTSYS.on(
+        "chars", [](SnapshotWriter& w) { RL_CCHARSYS.save(w); },
+        [](SnapshotReader& r) { return RL_CHARSYS.restore(r); });
+
+    RL_SNAPSHOTSYS.on(
+        "flow_fields", [](SnapshotWriter& w) { RL_CFLOWFIELDSYS.save(w); },
+        [](SnapshotReader& r) { return RL_FLOWFIELDSYS.restore(r); });
+
+    RL_SNAPSHOTSYS.on(
+        "paths", [](SnapshotWriter& w) { RL_CPATHSYS.save(w); },
+        [](SnapshotReader& r) { return RL_PATHSYS.restore(r); });
+
+    RL_SNAPSHOTSYS.on(
+        "ability_runner",
+        [](SnapshotWriter& w) { RL_CABILITYRUNNER.save(w); },
+        [](SnapshotReader& r) { return RL_ABILITYRUNNER.restore(r); });
+
     RL_ABILITYLIB.init();
+    RL_ABILITYRUNNER.init();
     RL_CHARARCHLIB.init();
 
     // Load demo from scene events.
@@ -63,28 +98,83 @@ void Game::run() {
 
   RL_PHASEBUS.on(LifeCyclePhase::Shutdown, [] {
     RL_CHARARCHLIB.shutdown();
+    RL_ABILITYRUNNER.shutdown();
     RL_ABILITYLIB.shutdown();
 
     RL_COMBATSYS.shutdown();
     RL_CHARSYS.shutdown();
     RL_PLAYCAMSYS.shutdown();
+    RL_PATHSYS.shutdown();
+    RL_FLOWFIELDSYS.shutdown();
     RL_TILESYS.shutdown();
     RL_SURFACESYS.shutdown();
     RL_MATERIALLIB.shutdown();
   });
 
-  RL_PHASEBUS.on(TickPhase::FixedUpdate, [](const FramePacket& f) {
-    RL_COMBATSYS.fixedUpdate(f);
-    RL_CHARSYS.fixedUpdate(f);
-    RL_PLAYCAMSYS.fixedUpdate(f);
-  });
+  // Resources declare what each task touches so the bus can run the ones that
+  // do not conflict side by side. Draw submission is not thread-safe, hence
+  // the shared render writer. Optional tasks are left out of catch-up steps
+  // when the frame is over budget.
+  RL_PHASEBUS.on(TickPhase::FixedUpdate,
+                 {
+                     .name = "combat",
+                     .reads = {"hitbox.contacts"},
+                 },
+                 [](const FramePacket& f) { RL_COMBATSYS.fixedUpdate(f); });
 
-  RL_PHASEBUS.on(TickPhase::Update, [](const FramePacket& f) {
-    RL_CHARSYS.update(f);
-    RL_TILESYS.update(f);
-  });
+  RL_PHASEBUS.on(TickPhase::FixedUpdate,
+                 {
+                     .name = "flow_fields",
+                     .reads = {"tiles", "transform"},
+                     .writes = {"flow_fields"},
+                 },
+                 [](const FramePacket& f) { RL_FLOWFIELDSYS.fixedUpdate(f); });
+
+  RL_PHASEBUS.on(TickPhase::FixedUpdate,
+                 {
+                     .name = "paths",
+                     .reads = {"tiles"},
+                     .writes = {"paths"},
+                 },
+                 [](const FramePacket& f) { RL_PATHSYS.fixedUpdate(f); });
+
+  RL_PHASEBUS.on(TickPhase::FixedUpdate,
+                 {
+                     .name = "chars",
+                     .reads = {"relevance", "input", "flow_fields", "paths"},
+                     .writes = {"chars", "physics", "anim", "hitbox",
+                                "transform", "sound", kPhaseResourceEvents},
+                 },
+                 [](const FramePacket& f) { RL_CHARSYS.fixedUpdate(f); });
+
+  RL_PHASEBUS.on(TickPhase::FixedUpdate,
+                 {
+                     .name = "player_camera",
+                     .reads = {"chars", "transform", "input"},
+                     .writes = {"camera"},
+                     .after = {"chars"},
+                     .optional = true,
+                 },
+                 [](const FramePacket& f) { RL_PLAYCAMSYS.fixedUpdate(f); });
+
+  RL_PHASEBUS.on(TickPhase::Update,
+                 {
+                     .name = "chars",
+                     .reads = {"chars", "transform", "anim"},
+                     .writes = {"render"},
+                 },
+                 [](const FramePacket& f) { RL_CHARSYS.update(f); });
+
+  RL_PHASEBUS.on(TickPhase::Update,
+                 {
+                     .name = "tiles",
+                     .reads = {"tiles"},
+                     .writes = {"render"},
+                     .after = {"chars"},
+                 },
+                 [](const FramePacket& f) { RL_TILESYS.update(f); });
 
-  RL_ENGINE.init();
+  RL_ENGINE.init(desc);
   RL_ENGINE.run();
   RL_ENGINE.shutdown();
 }
@@ -92,7 +182,7 @@ void Game::run() {
 void Game::On(const Message& m, void*) {
   switch (m.id) {
     case kSceneMessageIdSceneLoaded:
-      demo.seed = 1231031;
+      demo.seed = RL_CENGINE.seed();
       internal::loadDemo(demo);
       break;
     case kSceneMessageIdSceneUnloaded:
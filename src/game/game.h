@@ -17,6 +17,7 @@
 #define GAME_GAME_H_
 
 #include "engine/common.h"
+#include "engine/core/engine.h"
 #include "engine/event/message.h"
 
 namespace rl {
@@ -24,7 +25,7 @@ class Game {
  public:
   static Game& instance();
 
-  void run();
+  void run(EngineDesc desc = {});
 
  private:
   static void On(const Message& m, void*);
@@ -0,0 +1,84 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef GAME_PATH_FLOW_FIELD_H_
+#define GAME_PATH_FLOW_FIELD_H_
+
+#include "engine/common.h"
+#include "engine/core/handle.h"
+#include "engine/transform/transform.h"
+#include "game/world/tile.h"
+#include "game/world/tile_set.h"
+
+namespace rl {
+struct FlowFieldTag {};
+using FlowFieldHandle = Handle<FlowFieldTag>;
+
+using FlowCost = u16;
+constexpr auto kUnreachableFlowCost = static_cast<FlowCost>(-1);
+
+// Index into kFlowDirs, or none at the goal and where it cannot be reached.
+using FlowDir = u8;
+constexpr auto kNoFlowDir = static_cast<FlowDir>(-1);
+
+inline constexpr std::array<TileCoord, 8> kFlowDirs{{
+    {1, 0},
+    {-1, 0},
+    {0, 1},
+    {0, -1},
+    {1, 1},
+    {-1, 1},
+    {1, -1},
+    {-1, -1},
+}};
+
+struct FlowFieldDesc {
+  TileSetHandle set{kInvalidHandle};
+  TransformHandle target{kInvalidHandle};
+  Distance arrival{kTileSizeF32 * .5f};
+};
+
+enum class FlowFieldPhase : u8 { Idle, Integrate, Direct };
+
+// One integration field and one direction field toward a moving target,
+// shared by everything chasing it. Lookups read the front fields while a
+// rebuild fills the back ones.
+struct FlowField {
+  FlowFieldHandle handle{kInvalidHandle};
+  TileSetHandle set{kInvalidHandle};
+  TransformHandle target{kInvalidHandle};
+  Distance arrival{.0f};
+  u32 refs{0};
+
+  bool ready{false};
+  Position targetPos{};
+  TileCoord goal{-1, -1};
+  u32 revision{0};
+  TileExtent extent{};
+  std::vector<FlowCost> costs{};
+  std::vector<FlowDir> dirs{};
+
+  FlowFieldPhase phase{FlowFieldPhase::Idle};
+  TileCoord buildGoal{-1, -1};
+  u32 buildRevision{0};
+  u32 head{0};
+  u32 cursor{0};
+  std::vector<FlowCost> buildCosts{};
+  std::vector<FlowDir> buildDirs{};
+  std::vector<u32> queue{};
+};
+}  // namespace rl
+
+#endif  // GAME_PATH_FLOW_FIELD_H_
@@ -0,0 +1,336 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "flow_field_system.h"
+////////////////////////////////////////////////////////////////////////////////
+
+#include "engine/core/log.h"
+#include "engine/core/vector.h"
+#include "engine/transform/transform_system.h"
+#include "game/world/tile_system.h"
+#include "game/world/tile_utils.h"
+
+namespace rl {
+namespace internal {
+bool flowOpen(const TileMap& map, TileUnit x, TileUnit y) {
+  if (x < 0 || y < 0 || x >= map.extent.x || y >= map.extent.y) return false;
+  return map.at(x, y).passable();
+}
+
+usize flowIndex(const TileExtent& extent, TileCoord c) {
+  return static_cast<usize>(c.y) * extent.x + c.x;
+}
+
+bool flowInside(const TileExtent& extent, TileCoord c) {
+  return c.x >= 0 && c.y >= 0 && c.x < extent.x && c.y < extent.y;
+}
+
+// A target off the set is chased to the closest cell on it.
+TileCoord flowClamp(const TileExtent& extent, TileCoord c) {
+  return {std::clamp(c.x, 0, std::max(extent.x - 1, 0)),
+          std::clamp(c.y, 0, std::max(extent.y - 1, 0))};
+}
+}  // namespace internal
+
+FlowFieldSystem& FlowFieldSystem::instance() {
+  static FlowFieldSystem inst;
+  return inst;
+}
+
+void FlowFieldSystem::init() {
+  RL_LOG_DEBUG("FlowFieldSystem::init");
+  constexpr auto kFieldCapacity = 16;
+  hFieldPool_.clear();
+  hFieldPool_.reserve(kFieldCapacity);
+  fields_.reserve(kFieldCapacity);
+  stats_ = {};
+}
+
+void FlowFieldSystem::shutdown() {
+  RL_LOG_DEBUG("FlowFieldSystem::shutdown");
+  hFieldPool_.clear();
+  fields_.clear();
+  stats_ = {};
+}
+
+void FlowFieldSystem::save(SnapshotWriter& w) const {
+  hFieldPool_.save(w);
+  w.write(static_cast<u32>(fields_.size()));
+
+  for (const auto& f : fields_) {
+    w.write(f.handle);
+    w.write(f.set);
+    w.write(f.target);
+    w.write(f.arrival);
+    w.write(f.refs);
+    w.write(f.ready);
+    w.write(f.targetPos);
+    w.write(f.goal);
+    w.write(f.revision);
+    w.write(f.extent);
+    w.write(f.costs);
+    w.write(f.dirs);
+    w.write(f.phase);
+    w.write(f.buildGoal);
+    w.write(f.buildRevision);
+    w.write(f.head);
+    w.write(f.cursor);
+    w.write(f.buildCosts);
+    w.write(f.buildDirs);
+    w.write(f.queue);
+  }
+}
+
+bool FlowFieldSystem::restore(SnapshotReader& r) {
+  u32 count{0};
+  if (!hFieldPool_.restore(r) || !r.read(count)) return false;
+  fields_.resize(count);
+
+  for (auto& f : fields_) {
+    auto ok = r.read(f.handle) && r.read(f.set) && r.read(f.target) &&
+              r.read(f.arrival) && r.read(f.refs) && r.read(f.ready) &&
+              r.read(f.targetPos) && r.read(f.goal) && r.read(f.revision) &&
+              r.read(f.extent) && r.read(f.costs) && r.read(f.dirs) &&
+              r.read(f.phase) && r.read(f.buildGoal) &&
+              r.read(f.buildRevision) && r.read(f.head) && r.read(f.cursor) &&
+              r.read(f.buildCosts) && r.read(f.buildDirs) && r.read(f.queue);
+    if (!ok) return false;
+  }
+
+  return true;
+}
+
+void FlowFieldSystem::fixedUpdate(const FramePacket&) {
+  stats_.fields = 0;
+  stats_.rebuilds = 0;
+  stats_.cells = 0;
+  auto budget = kCellBudget_;
+
+  for (auto& f : fields_) {
+    if (!f.handle || !hFieldPool_.alive(f.handle)) continue;
+    ++stats_.fields;
+    const auto* set = RL_CTILESYS.tileset(f.set);
+    const auto* target = RL_CTRANSSYS.global(f.target);
+    if (!set || !target) continue;
+
+    f.targetPos = target->pos;
+    auto goal = internal::flowClamp(set->map.extent, tileAt(*set, f.targetPos));
+
+    // A rebuild in flight runs to the end before looking at the target
+    // again, so a target crossing cells every tick cannot starve it.
+    if (f.phase == FlowFieldPhase::Idle &&
+        (!f.ready || goal != f.goal || set->revision != f.revision)) {
+      begin(f, *set, goal);
+    }
+
+    if (budget == 0) continue;
+
+    if (f.phase == FlowFieldPhase::Integrate) {
+      budget -= integrate(f, *set, budget);
+    }
+
+    if (f.phase == FlowFieldPhase::Direct) {
+      budget -= direct(f, *set, budget);
+    }
+  }
+
+  stats_.cells = kCellBudget_ - budget;
+}
+
+FlowFieldHandle FlowFieldSystem::acquire(const FlowFieldDesc& desc) {
+  RL_ASSERT(desc.set && desc.target,
+            "FlowFieldSystem::acquire: Invalid flow field description!");
+
+  for (auto& f : fields_) {
+    if (!f.handle || !hFieldPool_.alive(f.handle)) continue;
+    if (f.set != desc.set || f.target != desc.target) continue;
+    ++f.refs;
+    return f.handle;
+  }
+
+  auto h = hFieldPool_.generate();
+  ensureCapacity(fields_, h.index);
+  auto& f = fields_[h.index];
+  f = {};
+  f.handle = h;
+  f.set = desc.set;
+  f.target = desc.target;
+  f.arrival = desc.arrival;
+  f.refs = 1;
+  return h;
+}
+
+void FlowFieldSystem::release(FlowFieldHandle h) {
+  auto* f = field(h);
+  if (!f) return;
+  RL_ASSERT(f->refs > 0, "FlowFieldSystem::release: Field already released!");
+  if (f->refs > 0 && --f->refs > 0) return;
+  *f = {};
+  hFieldPool_.destroy(h);
+}
+
+Steering FlowFieldSystem::steer(FlowFieldHandle h, const Position& pos) const {
+  const auto* f = field(h);
+  if (!f || !f->ready) return {};
+
+  auto toTarget = f->targetPos - pos;
+  if (toTarget.magSqrd() <= f->arrival * f->arrival) return {};
+
+  const auto* set = RL_CTILESYS.tileset(f->set);
+  if (!set) return {};
+  auto cell = tileAt(*set, pos);
+
+  if (cell == f->goal || !internal::flowInside(f->extent, cell)) {
+    return toTarget.normalized();
+  }
+
+  auto dir = f->dirs[internal::flowIndex(f->extent, cell)];
+  if (dir == kNoFlowDir) return {};
+
+  // Head for the next cell center rather than along the raw direction, so
+  // bodies wider than a point do not clip the corners the field avoided.
+  return (tileCenter(*set, cell + kFlowDirs[dir]) - pos).normalized();
+}
+
+FlowCost FlowFieldSystem::cost(FlowFieldHandle h, const Position& pos) const {
+  const auto* f = field(h);
+  if (!f || !f->ready) return kUnreachableFlowCost;
+  const auto* set = RL_CTILESYS.tileset(f->set);
+  if (!set) return kUnreachableFlowCost;
+  auto cell = tileAt(*set, pos);
+  if (!internal::flowInside(f->extent, cell)) return kUnreachableFlowCost;
+  return f->costs[internal::flowIndex(f->extent, cell)];
+}
+
+const FlowField* FlowFieldSystem::field(FlowFieldHandle h) const {
+  if (!h || !hFieldPool_.alive(h)) return nullptr;
+  return &fields_[h.index];
+}
+
+FlowField* FlowFieldSystem::field(FlowFieldHandle h) {
+  if (!h || !hFieldPool_.alive(h)) return nullptr;
+  return &fields_[h.index];
+}
+
+void FlowFieldSystem::begin(FlowField& f, const TileSet& set, TileCoord goal) {
+  const auto& map = set.map;
+  auto count = static_cast<usize>(map.extent.x) * map.extent.y;
+
+  f.phase = FlowFieldPhase::Integrate;
+  f.buildGoal = goal;
+  f.buildRevision = set.revision;
+  f.head = 0;
+  f.cursor = 0;
+  f.buildCosts.assign(count, kUnreachableFlowCost);
+  f.buildDirs.assign(count, kNoFlowDir);
+  f.queue.clear();
+  f.queue.reserve(count);
+
+  // The goal is seeded even when blocked: the target is standing on it.
+  if (internal::flowInside(map.extent, goal)) {
+    auto i = internal::flowIndex(map.extent, goal);
+    f.buildCosts[i] = 0;
+    f.queue.push_back(static_cast<u32>(i));
+  }
+}
+
+usize FlowFieldSystem::integrate(FlowField& f, const TileSet& set,
+                                 usize budget) {
+  const auto& map = set.map;
+  const auto w = map.extent.x;
+  usize used = 0;
+
+  // Breadth-first over the 4-connected passable cells: every step costs the
+  // same, so the first visit is the shortest.
+  while (f.head < f.queue.size() && used < budget) {
+    auto i = f.queue[f.head++];
+    ++used;
+    auto x = static_cast<TileUnit>(i % w);
+    auto y = static_cast<TileUnit>(i / w);
+    auto next = static_cast<FlowCost>(f.buildCosts[i] + 1);
+    if (next == kUnreachableFlowCost) continue;
+
+    for (usize d = 0; d < 4; ++d) {
+      auto nx = x + kFlowDirs[d].x;
+      auto ny = y + kFlowDirs[d].y;
+      if (!internal::flowOpen(map, nx, ny)) continue;
+      auto n = internal::flowIndex(map.extent, {nx, ny});
+      if (f.buildCosts[n] != kUnreachableFlowCost) continue;
+      f.buildCosts[n] = next;
+      f.queue.push_back(static_cast<u32>(n));
+    }
+  }
+
+  if (f.head == f.queue.size()) f.phase = FlowFieldPhase::Direct;
+  return used;
+}
+
+usize FlowFieldSystem::direct(FlowField& f, const TileSet& set,
+                              usize budget) {
+  const auto& map = set.map;
+  const auto w = map.extent.x;
+  const auto count = static_cast<u32>(f.buildCosts.size());
+  usize used = 0;
+
+  while (f.cursor < count && used < budget) {
+    auto i = f.cursor++;
+    ++used;
+    auto best = f.buildCosts[i];
+    if (best == kUnreachableFlowCost || best == 0) continue;
+    auto x = static_cast<TileUnit>(i % w);
+    auto y = static_cast<TileUnit>(i / w);
+    auto dir = kNoFlowDir;
+
+    for (usize d = 0; d < kFlowDirs.size(); ++d) {
+      const auto& o = kFlowDirs[d];
+      auto nx = x + o.x;
+      auto ny = y + o.y;
+      if (!internal::flowInside(map.extent, {nx, ny})) continue;
+
+      // Diagonals need both sides open, or bodies would cut wall corners.
+      auto diagonal = o.x != 0 && o.y != 0;
+
+      if (diagonal && (!internal::flowOpen(map, nx, y) ||
+                       !internal::flowOpen(map, x, ny))) {
+        continue;
+      }
+
+      auto c = f.buildCosts[internal::flowIndex(map.extent, {nx, ny})];
+      if (c >= best) continue;
+      best = c;
+      dir = static_cast<FlowDir>(d);
+    }
+
+    f.buildDirs[i] = dir;
+  }
+
+  if (f.cursor < count) return used;
+
+  std::swap(f.costs, f.buildCosts);
+  std::swap(f.dirs, f.buildDirs);
+  f.goal = f.buildGoal;
+  f.revision = f.buildRevision;
+  f.extent = map.extent;
+  f.ready = true;
+  f.phase = FlowFieldPhase::Idle;
+  ++stats_.rebuilds;
+  return used;
+}
+}  // namespace rl
@@ -0,0 +1,80 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef GAME_PATH_FLOW_FIELD_SYSTEM_H_
+#define GAME_PATH_FLOW_FIELD_SYSTEM_H_
+
+#include "engine/common.h"
+#include "engine/core/frame.h"
+#include "engine/core/handle.h"
+#include "engine/physics/physics.h"
+#include "engine/snapshot/snapshot.h"
+#include "game/path/flow_field.h"
+
+namespace rl {
+struct FlowFieldStats {
+  usize fields{0};
+  usize rebuilds{0};
+  usize cells{0};  // Visited this tick, across every field.
+};
+
+class FlowFieldSystem {
+ public:
+  static FlowFieldSystem& instance();
+
+  void init();
+  void shutdown();
+
+  void save(SnapshotWriter& w) const;
+  bool restore(SnapshotReader& r);
+
+  void fixedUpdate(const FramePacket&);
+
+  // Shared by every caller chasing the same target over the same set.
+  [[nodiscard]] FlowFieldHandle acquire(const FlowFieldDesc& desc);
+  void release(FlowFieldHandle h);
+
+  // Unit steering toward the target from pos, zero once arrived or if there
+  // is no way there.
+  [[nodiscard]] Steering steer(FlowFieldHandle h, const Position& pos) const;
+  [[nodiscard]] FlowCost cost(FlowFieldHandle h, const Position& pos) const;
+
+  const FlowField* field(FlowFieldHandle h) const;
+  const FlowFieldStats& stats() const noexcept { return stats_; }
+
+ private:
+  // Cells a tick may visit across every field. A bigger floor rebuilds over
+  // several ticks, steering by the previous field meanwhile.
+  inline static constexpr usize kCellBudget_ = 1 << 16;
+
+  HandlePool<FlowFieldTag> hFieldPool_{};
+  std::vector<FlowField> fields_{};
+  FlowFieldStats stats_{};
+
+  FlowFieldSystem() = default;
+
+  FlowField* field(FlowFieldHandle h);
+
+  void begin(FlowField& f, const TileSet& set, TileCoord goal);
+  usize integrate(FlowField& f, const TileSet& set, usize budget);
+  usize direct(FlowField& f, const TileSet& set, usize budget);
+};
+}  // namespace rl
+
+#define RL_FLOWFIELDSYS (::rl::FlowFieldSystem::instance())
+#define RL_CFLOWFIELDSYS \
+  (static_cast<const ::rl::FlowFieldSystem&>(::rl::FlowFieldSystem::instance()))
+
+#endif  // GAME_PATH_FLOW_FIELD_SYSTEM_H_
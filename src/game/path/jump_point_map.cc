@@ -0,0 +1,150 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "jump_point_map.h"
+////////////////////////////////////////////////////////////////////////////////
+
+namespace rl {
+namespace internal {
+bool jumpForced(const PathGrid& grid, TileCoord n, usize d) {
+  auto back = n - kJumpDirs[d];
+
+  for (auto side : {kJumpDirs[(d + 2) % kJumpDirCount],
+                    kJumpDirs[(d + 6) % kJumpDirCount]}) {
+    if (grid.passable(n.x + side.x, n.y + side.y) &&
+        !grid.passable(back.x + side.x, back.y + side.y)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool jumpDiagonalLegal(const PathGrid& grid, TileCoord c, usize d) {
+  const auto& o = kJumpDirs[d];
+  return grid.passable(c.x + o.x, c.y) && grid.passable(c.x, c.y + o.y) &&
+         grid.passable(c.x + o.x, c.y + o.y);
+}
+
+s8 jumpNext(s8 v) { return static_cast<s8>(v > 0 ? v + 1 : v - 1); }
+
+void buildJumpChunk(JumpPointMap& jm, const PathGrid& grid, TileUnit cx,
+                    TileUnit cy) {
+  auto x0 = cx * kPathChunkSize;
+  auto y0 = cy * kPathChunkSize;
+  auto x1 = std::min(x0 + kPathChunkSize, jm.extent.x);
+  auto y1 = std::min(y0 + kPathChunkSize, jm.extent.y);
+
+  auto inChunk = [&](TileCoord c) {
+    return c.x >= x0 && c.y >= y0 && c.x < x1 && c.y < y1;
+  };
+
+  // Straight directions first: diagonals read them. Cells are walked against
+  // the direction, so the neighbor a distance derives from is already done.
+  for (auto diagonal : {false, true}) {
+    for (usize d = diagonal ? 1 : 0; d < kJumpDirCount; d += 2) {
+      const auto& o = kJumpDirs[d];
+
+      for (TileUnit j = 0; j < y1 - y0; ++j) {
+        auto y = o.y > 0 ? y1 - 1 - j : y0 + j;
+
+        for (TileUnit i = 0; i < x1 - x0; ++i) {
+          auto x = o.x > 0 ? x1 - 1 - i : x0 + i;
+          TileCoord c{x, y};
+          auto& dist = jm.dists[grid.index(c)][d];
+          dist = 0;
+          if (!grid.passable(x, y)) continue;
+          auto n = c + o;
+
+          if (diagonal) {
+            if (!jumpDiagonalLegal(grid, c, d)) continue;
+
+            if (!inChunk(n)) {
+              dist = 1;
+              continue;
+            }
+
+            // A diagonal stops where either of its straight parts would
+            // reach a jump point.
+            const auto& dn = jm.dists[grid.index(n)];
+            auto reaches = dn[d - 1] > 0 || dn[(d + 1) % kJumpDirCount] > 0;
+            dist = reaches ? 1 : jumpNext(dn[d]);
+          } else {
+            if (!grid.passable(n.x, n.y)) continue;
+
+            if (!inChunk(n) || jumpForced(grid, n, d)) {
+              dist = 1;
+            } else {
+              dist = jumpNext(jm.dists[grid.index(n)][d]);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+}  // namespace internal
+
+void buildJumpPointMap(JumpPointMap& jm, const PathGrid& grid) {
+  jm.extent = grid.extent;
+  jm.chunks = {(grid.extent.x + kPathChunkSize - 1) / kPathChunkSize,
+               (grid.extent.y + kPathChunkSize - 1) / kPathChunkSize};
+  jm.dists.assign(grid.open.size(), {});
+
+  for (TileUnit cy = 0; cy < jm.chunks.y; ++cy) {
+    for (TileUnit cx = 0; cx < jm.chunks.x; ++cx) {
+      internal::buildJumpChunk(jm, grid, cx, cy);
+    }
+  }
+}
+
+usize repairJumpPointMap(JumpPointMap& jm, const PathGrid& grid,
+                         std::span<const TileCoord> changed) {
+  if (jm.extent != grid.extent) {
+    buildJumpPointMap(jm, grid);
+    return static_cast<usize>(jm.chunks.x) * jm.chunks.y;
+  }
+
+  std::vector<u8> dirty(static_cast<usize>(jm.chunks.x) * jm.chunks.y, 0);
+  usize count = 0;
+
+  for (auto e : changed) {
+    // Chunks holding the tile in their halo read it too.
+    for (auto y = e.y - 1; y <= e.y + 1; ++y) {
+      for (auto x = e.x - 1; x <= e.x + 1; ++x) {
+        if (!grid.inside({x, y})) continue;
+        auto& d = dirty[static_cast<usize>(y / kPathChunkSize) * jm.chunks.x +
+                        x / kPathChunkSize];
+        count += d == 0 ? 1 : 0;
+        d = 1;
+      }
+    }
+  }
+
+  for (TileUnit cy = 0; cy < jm.chunks.y && count > 0; ++cy) {
+    for (TileUnit cx = 0; cx < jm.chunks.x; ++cx) {
+      if (dirty[static_cast<usize>(cy) * jm.chunks.x + cx] == 0) continue;
+      internal::buildJumpChunk(jm, grid, cx, cy);
+    }
+  }
+
+  return count;
+}
+}  // namespace rl
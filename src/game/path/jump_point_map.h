@@ -0,0 +1,59 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef GAME_PATH_JUMP_POINT_MAP_H_
+#define GAME_PATH_JUMP_POINT_MAP_H_
+
+#include "engine/common.h"
+#include "game/path/path.h"
+#include "game/path/path_grid.h"
+#include "game/world/tile.h"
+
+namespace rl {
+// Even directions are straight, odd ones diagonal.
+constexpr usize kJumpDirCount = 8;
+
+inline constexpr std::array<TileCoord, kJumpDirCount> kJumpDirs{{
+    {0, -1},
+    {1, -1},
+    {1, 0},
+    {1, 1},
+    {0, 1},
+    {-1, 1},
+    {-1, 0},
+    {-1, -1},
+}};
+
+// Per direction: a positive value is the distance to the next jump point, any
+// other the negated count of open cells before a wall. Jumps stop at chunk
+// borders, so a chunk's distances only depend on its tiles and a one tile
+// halo.
+using JumpDistances = std::array<s8, kJumpDirCount>;
+
+// JPS+ data for a path grid. Diagonal moves never cut wall corners.
+struct JumpPointMap {
+  TileExtent extent{};
+  TileExtent chunks{};
+  std::vector<JumpDistances> dists{};
+};
+
+void buildJumpPointMap(JumpPointMap& jm, const PathGrid& grid);
+// Rebuilds the chunks holding a changed cell in their tiles or halo, and
+// returns their count.
+usize repairJumpPointMap(JumpPointMap& jm, const PathGrid& grid,
+                         std::span<const TileCoord> changed);
+}  // namespace rl
+
+#endif  // GAME_PATH_JUMP_POINT_MAP_H_
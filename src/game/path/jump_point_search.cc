@@ -0,0 +1,156 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "jump_point_search.h"
+////////////////////////////////////////////////////////////////////////////////
+
+namespace rl {
+namespace internal {
+// Arrival direction of the start node: it expands every direction.
+constexpr u8 kJumpDirStart = static_cast<u8>(kJumpDirCount);
+
+// Offsets from the arrival direction worth expanding: forward, the sides a
+// wall may have forced open and, straight only, the forward diagonals.
+std::span<const s32> jumpTurns(u8 dir) {
+  static constexpr std::array<s32, 8> kAll{0, 1, 2, 3, 4, 5, 6, 7};
+  static constexpr std::array<s32, 5> kStraight{0, -1, 1, -2, 2};
+  static constexpr std::array<s32, 3> kDiagonal{0, -1, 1};
+  if (dir == kJumpDirStart) return kAll;
+  if (dir % 2 == 0) return kStraight;
+  return kDiagonal;
+}
+}  // namespace internal
+
+bool JumpPointSearch::find(const PathGrid& grid, const JumpPointMap& jm,
+                           TileCoord start, TileCoord goal,
+                           std::vector<TileCoord>& path) {
+  path.clear();
+  expanded_ = 0;
+  if (!grid.passable(start.x, start.y) || !grid.passable(goal.x, goal.y)) {
+    return false;
+  }
+
+  if (start == goal) {
+    path.push_back(start);
+    return true;
+  }
+
+  reset(grid.open.size());
+  goal_ = goal;
+  auto goalCell = static_cast<u32>(grid.index(goal));
+  visit(grid, start, .0f, static_cast<u32>(grid.index(start)),
+        internal::kJumpDirStart);
+
+  while (!open_.empty()) {
+    std::pop_heap(open_.begin(), open_.end(), after);
+    auto cell = open_.back().cell;
+    open_.pop_back();
+    auto& node = nodes_[cell];
+    if (node.closed) continue;
+    node.closed = true;
+    ++expanded_;
+
+    if (cell == goalCell) {
+      for (auto i = cell; i != nodes_[i].parent; i = nodes_[i].parent) {
+        path.push_back(grid.coord(i));
+      }
+
+      path.push_back(start);
+      std::reverse(path.begin(), path.end());
+      return true;
+    }
+
+    auto c = grid.coord(cell);
+    auto g = node.g;
+    const auto& dists = jm.dists[cell];
+    auto arrival = node.dir;
+    auto toGoal = goal - c;
+    TileCoord span{std::abs(toGoal.x), std::abs(toGoal.y)};
+    TileCoord sign{(toGoal.x > 0) - (toGoal.x < 0),
+                   (toGoal.y > 0) - (toGoal.y < 0)};
+
+    for (auto turn : internal::jumpTurns(arrival)) {
+      auto d = static_cast<u8>((arrival == internal::kJumpDirStart
+                                    ? turn
+                                    : arrival + kJumpDirCount + turn) %
+                               kJumpDirCount);
+      const auto& o = kJumpDirs[d];
+      auto dist = static_cast<TileUnit>(dists[d]);
+      auto reach = std::abs(dist);
+
+      if (d % 2 == 0) {
+        auto along = o.x != 0 ? span.x : span.y;
+
+        // The goal sits on this line before the jump point or wall.
+        if (sign == o && along <= reach) {
+          visit(grid, goal, g + static_cast<f32>(along), cell, d);
+        } else if (dist > 0) {
+          visit(grid, c + o * dist, g + static_cast<f32>(dist), cell, d);
+        }
+
+        continue;
+      }
+
+      // Stop level with the goal so a straight jump can finish; the jump
+      // point further on may still be the way around a wall.
+      if (sign == o && (span.x <= reach || span.y <= reach)) {
+        auto steps = std::min(span.x, span.y);
+        visit(grid, c + o * steps,
+              g + kPathDiagonalCost * static_cast<f32>(steps), cell, d);
+      }
+
+      if (dist > 0) {
+        auto cost = kPathDiagonalCost * static_cast<f32>(dist);
+        visit(grid, c + o * dist, g + cost, cell, d);
+      }
+    }
+  }
+
+  return false;
+}
+
+void JumpPointSearch::reset(usize count) {
+  open_.clear();
+
+  if (nodes_.size() != count || ++search_ == 0) {
+    nodes_.assign(count, {});
+    search_ = 1;
+  }
+}
+
+void JumpPointSearch::visit(const PathGrid& grid, TileCoord c, f32 g,
+                            u32 parent, u8 dir) {
+  auto i = static_cast<u32>(grid.index(c));
+  auto& node = nodes_[i];
+
+  if (node.search == search_) {
+    if (node.closed || node.g <= g) return;
+  } else {
+    node.search = search_;
+    node.closed = false;
+  }
+
+  node.g = g;
+  node.parent = parent;
+  node.dir = dir;
+  open_.push_back({g + octileDistance(c, goal_), i});
+  std::push_heap(open_.begin(), open_.end(), after);
+}
+}  // namespace rl
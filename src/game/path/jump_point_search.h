@@ -0,0 +1,68 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef GAME_PATH_JUMP_POINT_SEARCH_H_
+#define GAME_PATH_JUMP_POINT_SEARCH_H_
+
+#include "engine/common.h"
+#include "game/path/jump_point_map.h"
+#include "game/path/path_grid.h"
+#include "game/world/tile.h"
+
+namespace rl {
+// A* over JPS+ jump points. Buffers are kept between searches, so one
+// instance should serve every search on a thread.
+class JumpPointSearch {
+ public:
+  // Fills path with the corners of a shortest 8-way path, start and goal
+  // included. Returns false, with path empty, if there is none.
+  bool find(const PathGrid& grid, const JumpPointMap& jm, TileCoord start,
+            TileCoord goal, std::vector<TileCoord>& path);
+
+  // Nodes the last find() expanded.
+  [[nodiscard]] usize expanded() const noexcept { return expanded_; }
+
+ private:
+  struct OpenNode {
+    f32 f{.0f};
+    u32 cell{0};
+  };
+
+  // Per cell, only meaningful when search matches the current one: the
+  // buffers are never cleared between searches.
+  struct Node {
+    u32 search{0};
+    f32 g{.0f};
+    u32 parent{0};
+    u8 dir{0};
+    bool closed{false};
+  };
+
+  u32 search_{0};
+  usize expanded_{0};
+  TileCoord goal_{};
+  std::vector<Node> nodes_{};
+  std::vector<OpenNode> open_{};
+
+  static bool after(const OpenNode& a, const OpenNode& b) {
+    return a.f > b.f || (a.f == b.f && a.cell > b.cell);
+  }
+
+  void reset(usize count);
+  void visit(const PathGrid& grid, TileCoord c, f32 g, u32 parent, u8 dir);
+};
+}  // namespace rl
+
+#endif  // GAME_PATH_JUMP_POINT_SEARCH_H_
@@ -0,0 +1,63 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef GAME_PATH_PATH_H_
+#define GAME_PATH_PATH_H_
+
+#include "engine/common.h"
+#include "engine/core/handle.h"
+#include "game/world/tile.h"
+#include "game/world/tile_set.h"
+
+namespace rl {
+// Tile maps are split in square chunks for path data: a tile edit only
+// rebuilds the chunks around it.
+constexpr TileSize kPathChunkSize = 32;
+constexpr f32 kPathDiagonalCost = 1.41421356f;
+
+// Cost of the cheapest 8-way move sequence between two cells on open floor.
+[[nodiscard]] inline f32 octileDistance(TileCoord a, TileCoord b) {
+  auto dx = static_cast<f32>(std::abs(a.x - b.x));
+  auto dy = static_cast<f32>(std::abs(a.y - b.y));
+  return std::max(dx, dy) + (kPathDiagonalCost - 1.0f) * std::min(dx, dy);
+}
+
+struct PathRequestTag {};
+using PathRequestHandle = Handle<PathRequestTag>;
+
+enum class PathStatus : u8 { Pending, Found, NoPath };
+
+struct PathRequestDesc {
+  TileSetHandle set{kInvalidHandle};
+  TileCoord start{};
+  TileCoord goal{};
+};
+
+struct PathRequest {
+  PathRequestHandle handle{kInvalidHandle};
+  TileSetHandle set{kInvalidHandle};
+  TileCoord start{};
+  TileCoord goal{};
+  PathStatus status{PathStatus::Pending};
+  // Corners from start to goal; consecutive ones are on a straight or
+  // diagonal line. Long paths only hold the corners refined so far, up to
+  // waypoints[refined]: see PathSystem::corners().
+  std::vector<TileCoord> path{};
+  std::vector<TileCoord> waypoints{};
+  u32 refined{0};
+};
+}  // namespace rl
+
+#endif  // GAME_PATH_PATH_H_
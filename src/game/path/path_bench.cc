@@ -0,0 +1,389 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "path_bench.h"
+////////////////////////////////////////////////////////////////////////////////
+
+#include "engine/core/log.h"
+#include "engine/core/random.h"
+#include "game/path/jump_point_map.h"
+#include "game/path/jump_point_search.h"
+#include "game/path/path.h"
+#include "game/path/path_graph.h"
+#include "game/path/path_grid.h"
+
+namespace rl {
+namespace internal {
+constexpr u64 kPathBenchSeed = 8081;
+
+void benchFill(PathGrid& grid, TileCoord min, TileCoord max, u8 open) {
+  for (auto y = min.y; y < max.y; ++y) {
+    for (auto x = min.x; x < max.x; ++x) grid.open[grid.index({x, y})] = open;
+  }
+}
+
+PathGrid makeBenchGrid(TileUnit size, u8 open) {
+  PathGrid grid{};
+  grid.extent = {size, size};
+  grid.open.assign(static_cast<usize>(size) * size, open);
+  return grid;
+}
+
+// Recursive backtracker on odd cells, then rooms and extra openings so there
+// is more than one way around.
+PathGrid makeBenchMaze(TileUnit size, Splitmix64& rng) {
+  auto grid = makeBenchGrid(size, 0);
+  std::vector<TileCoord> stack{{1, 1}};
+  grid.open[grid.index({1, 1})] = 1;
+
+  while (!stack.empty()) {
+    auto c = stack.back();
+    std::array<TileCoord, 4> next{};
+    usize count = 0;
+
+    for (auto o : {TileCoord{2, 0}, TileCoord{-2, 0}, TileCoord{0, 2},
+                   TileCoord{0, -2}}) {
+      auto n = c + o;
+      if (n.x < 1 || n.y < 1 || n.x >= size - 1 || n.y >= size - 1) continue;
+      if (grid.passable(n.x, n.y)) continue;
+      next[count++] = n;
+    }
+
+    if (count == 0) {
+      stack.pop_back();
+      continue;
+    }
+
+    auto n = next[rng.nextInt<usize>(0, count - 1)];
+    grid.open[grid.index({(c.x + n.x) / 2, (c.y + n.y) / 2})] = 1;
+    grid.open[grid.index(n)] = 1;
+    stack.push_back(n);
+  }
+
+  auto rooms = static_cast<usize>(size) * size / 4096;
+
+  for (usize i = 0; i < rooms; ++i) {
+    TileCoord extent{rng.nextInt<TileUnit>(3, 12),
+                     rng.nextInt<TileUnit>(3, 12)};
+    TileCoord min{rng.nextInt<TileUnit>(1, size - extent.x - 1),
+                  rng.nextInt<TileUnit>(1, size - extent.y - 1)};
+    benchFill(grid, min, min + extent, 1);
+  }
+
+  auto openings = static_cast<usize>(size) * size / 64;
+
+  for (usize i = 0; i < openings; ++i) {
+    TileCoord c{rng.nextInt<TileUnit>(1, size - 2),
+                rng.nextInt<TileUnit>(1, size - 2)};
+    grid.open[grid.index(c)] = 1;
+  }
+
+  return grid;
+}
+
+// Rooms walled off from each other, with a few doors per wall and some walls
+// knocked down into halls, plus pillars.
+PathGrid makeBenchFloor(TileUnit size, Splitmix64& rng) {
+  constexpr TileUnit kRoomSize = 20;
+  auto grid = makeBenchGrid(size, 1);
+
+  for (TileUnit y = 0; y < size; y += kRoomSize) {
+    for (TileUnit x = 0; x < size; x += kRoomSize) {
+      for (auto vertical : {false, true}) {
+        if (rng.nextInt(0, 4) == 0) continue;
+        TileCoord min{x, y};
+        TileCoord extent = vertical ? TileCoord{1, kRoomSize}
+                                    : TileCoord{kRoomSize, 1};
+        auto max = min + extent;
+        max = {std::min(max.x, size), std::min(max.y, size)};
+        benchFill(grid, min, max, 0);
+
+        for (auto doors = rng.nextInt(1, 3); doors > 0; --doors) {
+          auto at = rng.nextInt<TileUnit>(1, kRoomSize - 4);
+          auto width = rng.nextInt<TileUnit>(1, 3);
+          auto door = min + (vertical ? TileCoord{0, at} : TileCoord{at, 0});
+          auto end =
+              door + (vertical ? TileCoord{1, width} : TileCoord{width, 1});
+          benchFill(grid, door, {std::min(end.x, size), std::min(end.y, size)},
+                    1);
+        }
+      }
+    }
+  }
+
+  auto pillars = static_cast<usize>(size) * size / 256;
+
+  for (usize i = 0; i < pillars; ++i) {
+    TileCoord c{rng.nextInt<TileUnit>(0, size - 2),
+                rng.nextInt<TileUnit>(0, size - 2)};
+    benchFill(grid, c, c + TileCoord{2, 2}, 0);
+  }
+
+  return grid;
+}
+
+std::vector<std::pair<TileCoord, TileCoord>> makeBenchQueries(
+    const PathGrid& grid, usize count, Splitmix64& rng) {
+  std::vector<TileCoord> floor{};
+
+  for (usize i = 0; i < grid.open.size(); ++i) {
+    if (grid.open[i] != 0) floor.push_back(grid.coord(i));
+  }
+
+  std::vector<std::pair<TileCoord, TileCoord>> queries(count);
+
+  for (auto& q : queries) {
+    q.first = floor[rng.nextInt<usize>(0, floor.size() - 1)];
+    q.second = floor[rng.nextInt<usize>(0, floor.size() - 1)];
+  }
+
+  return queries;
+}
+
+// Plain A* on the same moves, to check the others against.
+class BenchAStar {
+ public:
+  f32 find(const PathGrid& grid, TileCoord start, TileCoord goal) {
+    auto count = grid.open.size();
+    g_.assign(count, std::numeric_limits<f32>::max());
+    closed_.assign(count, 0);
+    open_.clear();
+    expanded = 0;
+
+    auto push = [&](u32 i, f32 g) {
+      g_[i] = g;
+      open_.push_back({g + octileDistance(grid.coord(i), goal), i});
+      std::push_heap(open_.begin(), open_.end(), after);
+    };
+
+    push(static_cast<u32>(grid.index(start)), .0f);
+    auto goalCell = static_cast<u32>(grid.index(goal));
+
+    while (!open_.empty()) {
+      std::pop_heap(open_.begin(), open_.end(), after);
+      auto cell = open_.back().second;
+      open_.pop_back();
+      if (closed_[cell] != 0) continue;
+      closed_[cell] = 1;
+      ++expanded;
+      if (cell == goalCell) return g_[cell];
+      auto c = grid.coord(cell);
+
+      for (usize d = 0; d < kJumpDirCount; ++d) {
+        const auto& o = kJumpDirs[d];
+        auto n = c + o;
+        if (!grid.passable(n.x, n.y)) continue;
+
+        if (d % 2 == 1 && (!grid.passable(c.x + o.x, c.y) ||
+                           !grid.passable(c.x, c.y + o.y))) {
+          continue;
+        }
+
+        auto g = g_[cell] + (d % 2 == 1 ? kPathDiagonalCost : 1.0f);
+        auto i = static_cast<u32>(grid.index(n));
+        if (g < g_[i]) push(i, g);
+      }
+    }
+
+    return -1.0f;
+  }
+
+  usize expanded{0};
+
+ private:
+  using OpenNode = std::pair<f32, u32>;
+
+  std::vector<f32> g_{};
+  std::vector<u8> closed_{};
+  std::vector<OpenNode> open_{};
+
+  static bool after(const OpenNode& a, const OpenNode& b) { return a > b; }
+};
+
+f32 benchPathCost(const std::vector<TileCoord>& path) {
+  auto cost = .0f;
+
+  for (usize i = 1; i < path.size(); ++i) {
+    cost += octileDistance(path[i - 1], path[i]);
+  }
+
+  return cost;
+}
+
+f64 benchMs(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<f64, std::milli>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+// Flips a cell and returns it, as a door opening or closing would.
+TileCoord benchToggle(PathGrid& grid, TileCoord c) {
+  auto& open = grid.open[grid.index(c)];
+  open = open != 0 ? 0 : 1;
+  return c;
+}
+}  // namespace internal
+
+void runPathBench(usize queryCount, TileUnit size) {
+  Splitmix64 rng{internal::kPathBenchSeed};
+  auto grid = internal::makeBenchMaze(size, rng);
+
+  auto start = std::chrono::steady_clock::now();
+  JumpPointMap jm{};
+  buildJumpPointMap(jm, grid);
+  RL_LOG_INFO("runPathBench: ", size, "x", size, " maze, ", jm.chunks.x,
+              "x", jm.chunks.y, " chunks built in ", internal::benchMs(start),
+              "ms.");
+
+  auto queries = internal::makeBenchQueries(grid, queryCount, rng);
+  JumpPointSearch jps{};
+  std::vector<TileCoord> path{};
+  std::vector<f32> costs(queryCount);
+  usize expanded = 0;
+  usize found = 0;
+  start = std::chrono::steady_clock::now();
+
+  for (usize i = 0; i < queryCount; ++i) {
+    auto ok = jps.find(grid, jm, queries[i].first, queries[i].second, path);
+    costs[i] = ok ? internal::benchPathCost(path) : -1.0f;
+    expanded += jps.expanded();
+    found += ok ? 1 : 0;
+  }
+
+  auto ms = internal::benchMs(start);
+  auto count = static_cast<f64>(std::max<usize>(queryCount, 1));
+  RL_LOG_INFO("runPathBench: JPS+: ", queryCount, " queries (", found,
+              " found) in ", ms, "ms: ", count / ms, " queries/ms, ",
+              static_cast<f64>(expanded) / count, " nodes per query.");
+
+  // A* is far slower: a sample is enough to check costs and compare.
+  auto sample = std::min<usize>(queryCount, 500);
+  internal::BenchAStar astar{};
+  usize mismatches = 0;
+  expanded = 0;
+  start = std::chrono::steady_clock::now();
+
+  for (usize i = 0; i < sample; ++i) {
+    auto cost = astar.find(grid, queries[i].first, queries[i].second);
+    expanded += astar.expanded;
+    if (std::abs(cost - costs[i]) > 1e-2f) ++mismatches;
+  }
+
+  ms = internal::benchMs(start);
+  count = static_cast<f64>(std::max<usize>(sample, 1));
+  RL_LOG_INFO("runPathBench: A*: ", sample, " queries in ", ms, "ms: ",
+              count / ms, " queries/ms, ", static_cast<f64>(expanded) / count,
+              " nodes per query.");
+
+  if (mismatches > 0) {
+    RL_LOG_WARN("runPathBench: ", mismatches, " of ", sample,
+                " JPS+ paths differ in cost from A*!");
+  }
+
+  std::array<TileCoord, 1> changed{
+      internal::benchToggle(grid, {size / 2, size / 2})};
+  start = std::chrono::steady_clock::now();
+  auto chunks = repairJumpPointMap(jm, grid, changed);
+  RL_LOG_INFO("runPathBench: One tile edit rebuilt ", chunks, " chunks in ",
+              internal::benchMs(start) * 1e3, "us.");
+}
+
+void runHierarchicalPathBench(usize queryCount, TileUnit size) {
+  Splitmix64 rng{internal::kPathBenchSeed};
+  auto grid = internal::makeBenchFloor(size, rng);
+
+  auto start = std::chrono::steady_clock::now();
+  PathGraph graph{};
+  graph.build(grid);
+  RL_LOG_INFO("runHierarchicalPathBench: ", size, "x", size, " floor, ",
+              graph.nodeCount(), " entrance nodes laid out in ",
+              internal::benchMs(start), "ms.");
+
+  start = std::chrono::steady_clock::now();
+  auto built = graph.update(grid, std::numeric_limits<usize>::max());
+  RL_LOG_INFO("runHierarchicalPathBench: Entrance distances built in ",
+              internal::benchMs(start), "ms, ", built, " nodes expanded.");
+
+  auto queries = internal::makeBenchQueries(grid, queryCount, rng);
+  std::vector<std::vector<TileCoord>> waypoints(queryCount);
+  usize expanded = 0;
+  usize found = 0;
+  start = std::chrono::steady_clock::now();
+
+  for (usize i = 0; i < queryCount; ++i) {
+    const auto& q = queries[i];
+    auto ok = graph.find(grid, q.first, q.second, waypoints[i]);
+    expanded += graph.expanded();
+    found += ok ? 1 : 0;
+  }
+
+  auto ms = internal::benchMs(start);
+  auto count = static_cast<f64>(std::max<usize>(queryCount, 1));
+  RL_LOG_INFO("runHierarchicalPathBench: HPA*: ", queryCount, " queries (",
+              found, " found) in ", ms, "ms: ", count / ms, " queries/ms, ",
+              static_cast<f64>(expanded) / count, " nodes per query.");
+
+  // What a walker needs before its first step.
+  std::vector<TileCoord> corners{};
+  start = std::chrono::steady_clock::now();
+
+  for (const auto& w : waypoints) {
+    corners.clear();
+    if (w.size() > 1) graph.refine(grid, w[0], w[1], corners);
+  }
+
+  ms = internal::benchMs(start);
+  RL_LOG_INFO("runHierarchicalPathBench: First segment refined in ",
+              ms / count * 1e3, "us per query.");
+
+  // Full refinements against A*, which is slow enough at this size that a
+  // handful is all a bench can afford.
+  auto sample = std::min<usize>(queryCount, 5);
+  internal::BenchAStar astar{};
+  auto refined = .0f;
+  auto optimal = .0f;
+
+  for (usize i = 0; i < sample; ++i) {
+    const auto& w = waypoints[i];
+    if (w.empty()) continue;
+    corners.assign(1, w.front());
+
+    for (usize j = 1; j < w.size(); ++j) {
+      graph.refine(grid, w[j - 1], w[j], corners);
+    }
+
+    refined += internal::benchPathCost(corners);
+    optimal += astar.find(grid, queries[i].first, queries[i].second);
+  }
+
+  RL_LOG_INFO("runHierarchicalPathBench: Refined paths are ",
+              (refined / std::max(optimal, 1.0f) - 1.0f) * 100.0f,
+              "% longer than A* over ", sample, " queries.");
+
+  std::array<TileCoord, 1> changed{internal::benchToggle(
+      grid, {size / 2 + kPathChunkSize - 1, size / 2 + 3})};
+  start = std::chrono::steady_clock::now();
+  auto clusters = graph.repair(grid, changed);
+  graph.update(grid, std::numeric_limits<usize>::max());
+  RL_LOG_INFO("runHierarchicalPathBench: One border tile edit rebuilt ",
+              clusters, " clusters in ", internal::benchMs(start) * 1e3,
+              "us.");
+}
+}  // namespace rl
@@ -0,0 +1,32 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef GAME_PATH_PATH_BENCH_H_
+#define GAME_PATH_PATH_BENCH_H_
+
+#include "engine/common.h"
+#include "game/world/tile.h"
+
+namespace rl {
+// Runs queryCount random queries over a size x size braided maze with JPS+,
+// checks a sample against plain A* and logs queries per millisecond.
+void runPathBench(usize queryCount = 10000, TileUnit size = 512);
+// Runs queryCount random queries over a size x size floor of rooms with the
+// HPA* graph, refines a sample against plain A* and logs queries per
+// millisecond.
+void runHierarchicalPathBench(usize queryCount = 10000, TileUnit size = 4096);
+}  // namespace rl
+
+#endif  // GAME_PATH_PATH_BENCH_H_
@@ -0,0 +1,570 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "path_graph.h"
+////////////////////////////////////////////////////////////////////////////////
+
+#include "game/path/jump_point_map.h"
+
+namespace rl {
+void PathGraph::build(const PathGrid& grid) {
+  extent_ = grid.extent;
+  clusterCount_ = {(extent_.x + kPathChunkSize - 1) / kPathChunkSize,
+                   (extent_.y + kPathChunkSize - 1) / kPathChunkSize};
+  auto count = static_cast<usize>(clusterCount_.x) * clusterCount_.y;
+  clusters_.assign(count, {});
+  nodes_.clear();
+  free_.clear();
+  borders_.assign(count * static_cast<usize>(Side::Count), {});
+  stale_.clear();
+  local_.assign(static_cast<usize>(kPathChunkSize) * kPathChunkSize, {});
+  targets_.assign(local_.size(), 0);
+  localSearch_ = 0;
+
+  for (TileUnit cy = 0; cy < clusterCount_.y; ++cy) {
+    for (TileUnit cx = 0; cx < clusterCount_.x; ++cx) {
+      auto& cl = clusters_[static_cast<usize>(cy) * clusterCount_.x + cx];
+      cl.origin = {cx * kPathChunkSize, cy * kPathChunkSize};
+      cl.size = {std::min(kPathChunkSize, extent_.x - cl.origin.x),
+                 std::min(kPathChunkSize, extent_.y - cl.origin.y)};
+    }
+  }
+
+  for (TileUnit cy = 0; cy < clusterCount_.y; ++cy) {
+    for (TileUnit cx = 0; cx < clusterCount_.x; ++cx) {
+      buildBorder(grid, cx, cy, Side::East);
+      buildBorder(grid, cx, cy, Side::South);
+    }
+  }
+
+  for (u32 i = 0; i < count; ++i) stale_.push_back(i);
+}
+
+usize PathGraph::repair(const PathGrid& grid,
+                        std::span<const TileCoord> changed) {
+  if (extent_ != grid.extent) {
+    build(grid);
+    return clusters_.size();
+  }
+
+  constexpr auto kSides = static_cast<usize>(Side::Count);
+  std::vector<u8> dirtyBorders(borders_.size(), 0);
+  std::vector<u8> dirtyClusters(clusters_.size(), 0);
+
+  auto markBorder = [&](TileUnit cx, TileUnit cy, Side side) {
+    dirtyBorders[(static_cast<usize>(cy) * clusterCount_.x + cx) * kSides +
+                 static_cast<usize>(side)] = 1;
+  };
+
+  // Interior cells only move the distances of their cluster. Border cells
+  // also move the entrances, so the cluster across needs its distances too.
+  for (auto e : changed) {
+    if (!grid.inside(e)) continue;
+    auto cx = e.x / kPathChunkSize;
+    auto cy = e.y / kPathChunkSize;
+    auto ci = clusterOf(e);
+    dirtyClusters[ci] = 1;
+    const auto& cl = clusters_[ci];
+    auto lx = e.x - cl.origin.x;
+    auto ly = e.y - cl.origin.y;
+    if (lx == cl.size.x - 1) markBorder(cx, cy, Side::East);
+    if (lx == 0 && cx > 0) markBorder(cx - 1, cy, Side::East);
+    if (ly == cl.size.y - 1) markBorder(cx, cy, Side::South);
+    if (ly == 0 && cy > 0) markBorder(cx, cy - 1, Side::South);
+  }
+
+  for (usize i = 0; i < dirtyBorders.size(); ++i) {
+    if (dirtyBorders[i] == 0) continue;
+    auto ci = i / kSides;
+    auto side = static_cast<Side>(i % kSides);
+    auto cx = static_cast<TileUnit>(ci % clusterCount_.x);
+    auto cy = static_cast<TileUnit>(ci / clusterCount_.x);
+    buildBorder(grid, cx, cy, side);
+    dirtyClusters[ci] = 1;
+    auto nx = cx + (side == Side::East ? 1 : 0);
+    auto ny = cy + (side == Side::South ? 1 : 0);
+
+    if (nx < clusterCount_.x && ny < clusterCount_.y) {
+      dirtyClusters[static_cast<usize>(ny) * clusterCount_.x + nx] = 1;
+    }
+  }
+
+  usize count = 0;
+
+  for (u32 i = 0; i < dirtyClusters.size(); ++i) {
+    if (dirtyClusters[i] == 0) continue;
+    invalidate(i);
+    ++count;
+  }
+
+  return count;
+}
+
+usize PathGraph::update(const PathGrid& grid, usize budget) {
+  if (extent_ != grid.extent) return 0;
+  usize spent = 0;
+
+  while (!stale_.empty() && spent < budget) {
+    auto ci = stale_.back();
+    stale_.pop_back();
+    // Case: built by a find() since it was queued.
+    if (clusters_[ci].built) continue;
+    spent += buildDists(grid, ci);
+  }
+
+  return spent;
+}
+
+bool PathGraph::find(const PathGrid& grid, TileCoord start, TileCoord goal,
+                     std::vector<TileCoord>& waypoints) {
+  waypoints.clear();
+  expanded_ = 0;
+  if (extent_ != grid.extent) return false;
+
+  if (!grid.passable(start.x, start.y) || !grid.passable(goal.x, goal.y)) {
+    return false;
+  }
+
+  if (start == goal) {
+    waypoints.push_back(start);
+    return true;
+  }
+
+  // Start and goal join the graph for this query only: a sweep of their
+  // clusters gives their distance to the entrances. The sweeps head for the
+  // other end and leave out the entrances facing away, unless the search
+  // then finds no path.
+  auto goalCluster = clusterOf(goal);
+  auto direct = kNoDist_;
+
+  if (clusterOf(start) == goalCluster) {
+    const auto& cl = clusters_[goalCluster];
+    loadCluster(grid, cl);
+    searchCluster(cl, start, &goal);
+    direct = clusterDist(cl, goal);
+  }
+
+  for (auto heading : {true, false}) {
+    auto startSwept =
+        sweepEntrances(grid, start, heading ? &goal : nullptr, startDists_);
+    auto goalSwept =
+        sweepEntrances(grid, goal, heading ? &start : nullptr, goalDists_);
+
+    if (searchAbstract(grid, start, goal, goalCluster, direct, waypoints)) {
+      return true;
+    }
+
+    if (startSwept && goalSwept) break;
+  }
+
+  return false;
+}
+
+bool PathGraph::refine(const PathGrid& grid, TileCoord from, TileCoord to,
+                       std::vector<TileCoord>& corners) {
+  if (from == to) return true;
+  if (extent_ != grid.extent || !grid.passable(to.x, to.y)) return false;
+  auto step = to - from;
+
+  if (std::abs(step.x) + std::abs(step.y) == 1) {
+    corners.push_back(to);
+    return true;
+  }
+
+  auto ci = clusterOf(from);
+  if (ci != clusterOf(to)) return false;
+  const auto& cl = clusters_[ci];
+  loadCluster(grid, cl);
+  searchCluster(cl, from, &to);
+  if (clusterDist(cl, to) == kNoDist_) return false;
+
+  std::vector<TileCoord> cells{};
+  auto w = static_cast<u32>(cl.size.x);
+
+  auto i = localIndex(cl, to);
+
+  for (; local_[i].parent != i; i = local_[i].parent) {
+    cells.push_back({cl.origin.x + static_cast<TileUnit>(i % w),
+                     cl.origin.y + static_cast<TileUnit>(i / w)});
+  }
+
+  cells.push_back(from);
+
+  std::reverse(cells.begin(), cells.end());
+
+  // Keep the cells where the direction changes.
+  for (usize i = 1; i < cells.size(); ++i) {
+    if (i + 1 == cells.size() ||
+        cells[i + 1] - cells[i] != cells[i] - cells[i - 1]) {
+      corners.push_back(cells[i]);
+    }
+  }
+
+  return true;
+}
+
+u32 PathGraph::clusterOf(TileCoord c) const {
+  return static_cast<u32>((c.y / kPathChunkSize) * clusterCount_.x +
+                          c.x / kPathChunkSize);
+}
+
+std::vector<u32>& PathGraph::border(TileUnit cx, TileUnit cy, Side side) {
+  return borders_[(static_cast<usize>(cy) * clusterCount_.x + cx) *
+                      static_cast<usize>(Side::Count) +
+                  static_cast<usize>(side)];
+}
+
+u32 PathGraph::addNode(TileCoord cell, u32 cluster) {
+  u32 id{0};
+
+  if (free_.empty()) {
+    id = static_cast<u32>(nodes_.size());
+    nodes_.emplace_back();
+  } else {
+    id = free_.back();
+    free_.pop_back();
+  }
+
+  auto& nodes = clusters_[cluster].nodes;
+  nodes_[id] = {cell, cluster, static_cast<u32>(nodes.size()), kNoNode_};
+  nodes.push_back(id);
+  return id;
+}
+
+void PathGraph::removeNode(u32 id) {
+  std::erase(clusters_[nodes_[id].cluster].nodes, id);
+  nodes_[id] = {};
+  free_.push_back(id);
+}
+
+void PathGraph::buildBorder(const PathGrid& grid, TileUnit cx, TileUnit cy,
+                            Side side) {
+  auto& ids = border(cx, cy, side);
+  for (auto id : ids) removeNode(id);
+  ids.clear();
+
+  auto east = side == Side::East;
+  auto nx = cx + (east ? 1 : 0);
+  auto ny = cy + (east ? 0 : 1);
+  if (nx >= clusterCount_.x || ny >= clusterCount_.y) return;
+
+  auto ci = static_cast<u32>(cy * clusterCount_.x + cx);
+  auto ni = static_cast<u32>(ny * clusterCount_.x + nx);
+  const auto& cl = clusters_[ci];
+  TileCoord across = east ? TileCoord{1, 0} : TileCoord{0, 1};
+  TileCoord along = east ? TileCoord{0, 1} : TileCoord{1, 0};
+  auto first = east ? TileCoord{cl.origin.x + cl.size.x - 1, cl.origin.y}
+                    : TileCoord{cl.origin.x, cl.origin.y + cl.size.y - 1};
+  auto length = east ? cl.size.y : cl.size.x;
+
+  auto link = [&](TileUnit i) {
+    auto a = first + along * i;
+    auto na = addNode(a, ci);
+    auto nb = addNode(a + across, ni);
+    nodes_[na].peer = nb;
+    nodes_[nb].peer = na;
+    ids.push_back(na);
+    ids.push_back(nb);
+  };
+
+  TileUnit run = -1;
+
+  for (TileUnit i = 0; i <= length; ++i) {
+    auto a = first + along * i;
+    auto b = a + across;
+
+    if (i < length && grid.passable(a.x, a.y) && grid.passable(b.x, b.y)) {
+      if (run < 0) run = i;
+      continue;
+    }
+
+    if (run < 0) continue;
+
+    if (i - run >= kWideEntrance_) {
+      link(run);
+      link(i - 1);
+    } else {
+      link(run + (i - run) / 2);
+    }
+
+    run = -1;
+  }
+}
+
+void PathGraph::invalidate(u32 cluster) {
+  auto& cl = clusters_[cluster];
+
+  for (usize i = 0; i < cl.nodes.size(); ++i) {
+    nodes_[cl.nodes[i]].slot = static_cast<u32>(i);
+  }
+
+  // Case: already queued.
+  if (!cl.built) return;
+  cl.built = false;
+  stale_.push_back(cluster);
+}
+
+usize PathGraph::buildDists(const PathGrid& grid, u32 cluster) {
+  auto& cl = clusters_[cluster];
+  auto n = cl.nodes.size();
+  auto expanded = expanded_;
+  cl.dists.assign(n * n, kNoDist_);
+  for (usize i = 0; i < n; ++i) cl.dists[i * n + i] = .0f;
+  loadCluster(grid, cl);
+
+  // Distances are symmetric: each sweep fills the rest of a row and column.
+  for (usize i = 0; i + 1 < n; ++i) {
+    searchCluster(cl, nodes_[cl.nodes[i]].cell, nullptr, nullptr, i + 1);
+
+    for (usize j = i + 1; j < n; ++j) {
+      auto d = clusterDist(cl, nodes_[cl.nodes[j]].cell);
+      cl.dists[i * n + j] = d;
+      cl.dists[j * n + i] = d;
+    }
+  }
+
+  cl.built = true;
+  return std::exchange(expanded_, expanded) - expanded;
+}
+
+void PathGraph::loadCluster(const PathGrid& grid, const Cluster& cl) {
+  // A copy of the cluster's cells with a closed rim: neighbors are then one
+  // offset away, with no bounds to check.
+  auto stride = cl.size.x + 2;
+  cells_.assign(static_cast<usize>(stride) * (cl.size.y + 2), 0);
+
+  for (TileUnit y = 0; y < cl.size.y; ++y) {
+    auto row = grid.open.data() + grid.index(cl.origin + TileCoord{0, y});
+    std::copy_n(row, cl.size.x, cells_.data() + (y + 1) * stride + 1);
+  }
+}
+
+bool PathGraph::searchCluster(const Cluster& cl, TileCoord from,
+                              const TileCoord* goal, const TileCoord* heading,
+                              usize firstTarget) {
+  if (++localSearch_ == 0) {
+    for (auto& l : local_) l = {};
+    std::fill(targets_.begin(), targets_.end(), 0);
+    localSearch_ = 1;
+  }
+
+  auto w = static_cast<u32>(cl.size.x);
+  auto stride = cl.size.x + 2;
+  std::array<s32, kJumpDirCount> offsets{};
+  std::array<s32, kJumpDirCount> steps{};
+
+  for (usize d = 0; d < kJumpDirCount; ++d) {
+    offsets[d] = kJumpDirs[d].y * stride + kJumpDirs[d].x;
+    steps[d] = kJumpDirs[d].y * static_cast<s32>(w) + kJumpDirs[d].x;
+  }
+
+  localOpen_.clear();
+  const auto* toward = goal ? goal : heading;
+
+  auto visit = [&](u32 i, f32 g, u32 parent) {
+    auto& l = local_[i];
+
+    if (l.search == localSearch_) {
+      if (l.closed || l.g <= g) return;
+    } else {
+      l.search = localSearch_;
+      l.closed = false;
+    }
+
+    l.g = g;
+    l.parent = parent;
+    auto h = .0f;
+
+    // Octile distance is consistent, so cells are still closed with their
+    // shortest distance.
+    if (toward) {
+      h = octileDistance({cl.origin.x + static_cast<TileUnit>(i % w),
+                          cl.origin.y + static_cast<TileUnit>(i / w)},
+                         *toward);
+    }
+
+    localOpen_.push_back({g + h, i});
+    std::push_heap(localOpen_.begin(), localOpen_.end(), after);
+  };
+
+  auto goalIndex = goal ? localIndex(cl, *goal) : kNoNode_;
+  usize targets = 0;
+  auto bound = kNoDist_;
+
+  // Without a goal, only the entrances' distances matter: the sweep ends
+  // once they are all settled.
+  if (!goal) {
+    for (usize s = firstTarget; s < cl.nodes.size(); ++s) {
+      auto& t = targets_[localIndex(cl, nodes_[cl.nodes[s]].cell)];
+      if (t == localSearch_) continue;
+      t = localSearch_;
+      ++targets;
+    }
+  }
+
+  visit(localIndex(cl, from), .0f, localIndex(cl, from));
+
+  while (!localOpen_.empty()) {
+    std::pop_heap(localOpen_.begin(), localOpen_.end(), after);
+    auto [f, i] = localOpen_.back();
+    localOpen_.pop_back();
+    auto& l = local_[i];
+    if (l.closed) continue;
+    if (f > bound) return false;
+    l.closed = true;
+    ++expanded_;
+    if (i == goalIndex) return true;
+
+    if (targets_[i] == localSearch_) {
+      if (--targets == 0) return true;
+      if (heading && bound == kNoDist_) bound = f + kSweepSlack_;
+    }
+
+    auto cell = static_cast<s32>((i / w + 1) * stride + i % w + 1);
+
+    for (usize d = 0; d < kJumpDirCount; ++d) {
+      if (cells_[cell + offsets[d]] == 0) continue;
+      auto diagonal = d % 2 == 1;
+
+      // Diagonals sit between the straight directions on either side.
+      if (diagonal && (cells_[cell + offsets[d - 1]] == 0 ||
+                       cells_[cell + offsets[(d + 1) % kJumpDirCount]] == 0)) {
+        continue;
+      }
+
+      visit(static_cast<u32>(static_cast<s32>(i) + steps[d]),
+            l.g + (diagonal ? kPathDiagonalCost : 1.0f), i);
+    }
+  }
+
+  return true;
+}
+
+f32 PathGraph::clusterDist(const Cluster& cl, TileCoord c) const {
+  const auto& l = local_[localIndex(cl, c)];
+  return l.search == localSearch_ && l.closed ? l.g : kNoDist_;
+}
+
+bool PathGraph::sweepEntrances(const PathGrid& grid, TileCoord from,
+                               const TileCoord* heading,
+                               std::vector<f32>& dists) {
+  const auto& cl = clusters_[clusterOf(from)];
+  loadCluster(grid, cl);
+  auto complete = searchCluster(cl, from, nullptr, heading);
+  dists.resize(cl.nodes.size());
+
+  for (usize s = 0; s < cl.nodes.size(); ++s) {
+    dists[s] = clusterDist(cl, nodes_[cl.nodes[s]].cell);
+  }
+
+  return complete;
+}
+
+bool PathGraph::searchAbstract(const PathGrid& grid, TileCoord start,
+                               TileCoord goal, u32 goalCluster, f32 direct,
+                               std::vector<TileCoord>& waypoints) {
+  auto startId = static_cast<u32>(nodes_.size());
+  auto goalId = startId + 1;
+
+  if (abstract_.size() != nodes_.size() + 2 || ++search_ == 0) {
+    abstract_.assign(nodes_.size() + 2, {});
+    search_ = 1;
+  }
+
+  open_.clear();
+
+  auto cellOf = [&](u32 id) {
+    if (id == startId) return start;
+    if (id == goalId) return goal;
+    return nodes_[id].cell;
+  };
+
+  auto visit = [&](u32 id, f32 g, u32 parent) {
+    auto& a = abstract_[id];
+
+    if (a.search == search_) {
+      if (a.closed || a.g <= g) return;
+    } else {
+      a.search = search_;
+      a.closed = false;
+    }
+
+    a.g = g;
+    a.parent = parent;
+    auto h = kHeuristicWeight_ * octileDistance(cellOf(id), goal);
+    open_.push_back({g + h, id});
+    std::push_heap(open_.begin(), open_.end(), after);
+  };
+
+  visit(startId, .0f, startId);
+
+  while (!open_.empty()) {
+    std::pop_heap(open_.begin(), open_.end(), after);
+    auto id = open_.back().second;
+    open_.pop_back();
+    auto& a = abstract_[id];
+    if (a.closed) continue;
+    a.closed = true;
+    ++expanded_;
+
+    if (id == goalId) {
+      for (auto i = id; i != abstract_[i].parent; i = abstract_[i].parent) {
+        waypoints.push_back(cellOf(i));
+      }
+
+      waypoints.push_back(start);
+      std::reverse(waypoints.begin(), waypoints.end());
+      return true;
+    }
+
+    auto g = a.g;
+
+    if (id == startId) {
+      const auto& cl = clusters_[clusterOf(start)];
+
+      for (usize s = 0; s < cl.nodes.size(); ++s) {
+        if (startDists_[s] != kNoDist_) {
+          visit(cl.nodes[s], g + startDists_[s], id);
+        }
+      }
+
+      if (direct != kNoDist_) visit(goalId, g + direct, id);
+      continue;
+    }
+
+    const auto& node = nodes_[id];
+    visit(node.peer, g + 1.0f, id);
+    const auto& cl = clusters_[node.cluster];
+    if (!cl.built) buildDists(grid, node.cluster);
+    auto n = cl.nodes.size();
+
+    for (usize j = 0; j < n; ++j) {
+      auto d = cl.dists[node.slot * n + j];
+      if (j != node.slot && d != kNoDist_) visit(cl.nodes[j], g + d, id);
+    }
+
+    if (node.cluster == goalCluster && goalDists_[node.slot] != kNoDist_) {
+      visit(goalId, g + goalDists_[node.slot], id);
+    }
+  }
+
+  return false;
+}
+}  // namespace rl
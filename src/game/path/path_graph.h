@@ -0,0 +1,156 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef GAME_PATH_PATH_GRAPH_H_
+#define GAME_PATH_PATH_GRAPH_H_
+
+#include "engine/common.h"
+#include "game/path/path.h"
+#include "game/path/path_grid.h"
+#include "game/world/tile.h"
+
+namespace rl {
+// HPA* abstraction of a path grid. Clusters are the path chunks, entrances are
+// node pairs facing each other across cluster borders, and the distances
+// between the entrances of a cluster are cached. Long queries search this
+// graph, then get refined one cluster at a time.
+class PathGraph {
+ public:
+  // Lays out the clusters and their entrances. The distances between the
+  // entrances are left to update(), or to find() for the clusters it reaches
+  // first.
+  void build(const PathGrid& grid);
+  // Rebuilds the borders touched by changed cells and queues the clusters
+  // around them for their distances. Returns how many clusters it queued.
+  usize repair(const PathGrid& grid, std::span<const TileCoord> changed);
+  // Builds the distances of queued clusters until budget nodes are expanded.
+  // Returns the nodes it expanded.
+  usize update(const PathGrid& grid, usize budget);
+
+  // Fills waypoints from start to goal: two consecutive ones are either in
+  // the same cluster or facing each other across a border.
+  bool find(const PathGrid& grid, TileCoord start, TileCoord goal,
+            std::vector<TileCoord>& waypoints);
+  // Appends the corners of the shortest path from one waypoint to the next,
+  // from excluded. Returns false if the grid no longer links them.
+  bool refine(const PathGrid& grid, TileCoord from, TileCoord to,
+              std::vector<TileCoord>& corners);
+
+  // Abstract nodes and cluster cells the last find() expanded, without the
+  // distances it had to build.
+  [[nodiscard]] usize expanded() const noexcept { return expanded_; }
+  [[nodiscard]] bool built() const noexcept { return stale_.empty(); }
+  [[nodiscard]] usize nodeCount() const noexcept {
+    return nodes_.size() - free_.size();
+  }
+
+ private:
+  // Entrances at least this wide get a node pair at each end rather than one
+  // in the middle, so paths along a wall do not detour to its center.
+  inline static constexpr TileUnit kWideEntrance_ = 6;
+  // Inflates the abstract heuristic: the entrance graph is already an
+  // approximation, and a greedier search expands a fraction of the nodes.
+  inline static constexpr f32 kHeuristicWeight_ = 1.2f;
+  // An endpoint's sweep heads for the other end, and drops the entrances
+  // whose estimate through them is this much over the first one it settles.
+  inline static constexpr f32 kSweepSlack_ = 2.0f;
+  inline static constexpr u32 kNoNode_ = static_cast<u32>(-1);
+  inline static constexpr f32 kNoDist_ = std::numeric_limits<f32>::max();
+
+  enum class Side : u8 { East, South, Count };
+
+  struct Node {
+    TileCoord cell{};
+    u32 cluster{kNoNode_};
+    u32 slot{0};  // In the cluster's nodes.
+    u32 peer{kNoNode_};
+  };
+
+  struct Cluster {
+    TileCoord origin{};
+    TileExtent size{};
+    std::vector<u32> nodes{};
+    std::vector<f32> dists{};  // Node slot to node slot, row major.
+    bool built{false};         // Whether dists is up to date.
+  };
+
+  struct SearchNode {
+    u32 search{0};
+    f32 g{.0f};
+    u32 parent{0};
+    bool closed{false};
+  };
+
+  using OpenNode = std::pair<f32, u32>;
+
+  TileExtent extent_{};
+  TileExtent clusterCount_{};
+  std::vector<Cluster> clusters_{};
+  std::vector<Node> nodes_{};
+  std::vector<u32> free_{};
+  // Node pairs of each cluster's east and south borders.
+  std::vector<std::vector<u32>> borders_{};
+  std::vector<u32> stale_{};  // Clusters queued for their distances.
+
+  usize expanded_{0};
+  u32 localSearch_{0};
+  std::vector<SearchNode> local_{};
+  std::vector<OpenNode> localOpen_{};
+  std::vector<u8> cells_{};
+  std::vector<u32> targets_{};  // Stamped with the sweep that wants them.
+  u32 search_{0};
+  std::vector<SearchNode> abstract_{};
+  std::vector<OpenNode> open_{};
+  std::vector<f32> startDists_{};
+  std::vector<f32> goalDists_{};
+
+  static bool after(const OpenNode& a, const OpenNode& b) { return a > b; }
+
+  static u32 localIndex(const Cluster& cl, TileCoord c) {
+    return static_cast<u32>((c.y - cl.origin.y) * cl.size.x +
+                            (c.x - cl.origin.x));
+  }
+
+  u32 clusterOf(TileCoord c) const;
+  std::vector<u32>& border(TileUnit cx, TileUnit cy, Side side);
+
+  u32 addNode(TileCoord cell, u32 cluster);
+  void removeNode(u32 id);
+  void buildBorder(const PathGrid& grid, TileUnit cx, TileUnit cy, Side side);
+  void invalidate(u32 cluster);
+  // Returns the nodes it expanded, which find() does not count.
+  usize buildDists(const PathGrid& grid, u32 cluster);
+
+  // Copies a cluster's cells for the searches that follow.
+  void loadCluster(const PathGrid& grid, const Cluster& cl);
+  // A* over the loaded cluster from a cell to a goal. Without one, settles
+  // the entrances from the first target on: in distance order, or in
+  // distance plus octile distance to a heading, which gives up on the
+  // entrances past kSweepSlack_ of the first one. Returns false if it did.
+  bool searchCluster(const Cluster& cl, TileCoord from, const TileCoord* goal,
+                     const TileCoord* heading = nullptr,
+                     usize firstTarget = 0);
+  f32 clusterDist(const Cluster& cl, TileCoord c) const;
+  // Fills dists with the distance from a cell to each entrance of its
+  // cluster. Returns false if a heading left some out.
+  bool sweepEntrances(const PathGrid& grid, TileCoord from,
+                      const TileCoord* heading, std::vector<f32>& dists);
+  bool searchAbstract(const PathGrid& grid, TileCoord start, TileCoord goal,
+                      u32 goalCluster, f32 direct,
+                      std::vector<TileCoord>& waypoints);
+};
+}  // namespace rl
+
+#endif  // GAME_PATH_PATH_GRAPH_H_
@@ -0,0 +1,46 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "path_grid.h"
+////////////////////////////////////////////////////////////////////////////////
+
+namespace rl {
+void buildPathGrid(PathGrid& grid, const TileMap& map) {
+  grid.extent = map.extent;
+  grid.open.resize(map.tiles.size());
+
+  for (usize i = 0; i < map.tiles.size(); ++i) {
+    grid.open[i] = map.tiles[i].passable() ? 1 : 0;
+  }
+}
+
+void updatePathGrid(PathGrid& grid, const TileMap& map,
+                    std::span<const TileCoord> edits,
+                    std::vector<TileCoord>& changed) {
+  for (auto e : edits) {
+    if (!grid.inside(e)) continue;
+    auto i = grid.index(e);
+    u8 open = map.tiles[i].passable() ? 1 : 0;
+    if (grid.open[i] == open) continue;
+    grid.open[i] = open;
+    changed.push_back(e);
+  }
+}
+}  // namespace rl
@@ -0,0 +1,54 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef GAME_PATH_PATH_GRID_H_
+#define GAME_PATH_PATH_GRID_H_
+
+#include "engine/common.h"
+#include "game/world/tile.h"
+#include "game/world/tile_map.h"
+
+namespace rl {
+// Passability of a tile map, a byte per cell: all path searches read.
+struct PathGrid {
+  TileExtent extent{};
+  std::vector<u8> open{};
+
+  bool inside(TileCoord c) const {
+    return c.x >= 0 && c.y >= 0 && c.x < extent.x && c.y < extent.y;
+  }
+
+  bool passable(TileUnit x, TileUnit y) const {
+    return inside({x, y}) && open[static_cast<usize>(y) * extent.x + x] != 0;
+  }
+
+  usize index(TileCoord c) const {
+    return static_cast<usize>(c.y) * extent.x + c.x;
+  }
+
+  TileCoord coord(usize i) const {
+    return {static_cast<TileUnit>(i % extent.x),
+            static_cast<TileUnit>(i / extent.x)};
+  }
+};
+
+void buildPathGrid(PathGrid& grid, const TileMap& map);
+// Copies the edited cells' passability, and appends the ones that changed.
+void updatePathGrid(PathGrid& grid, const TileMap& map,
+                    std::span<const TileCoord> edits,
+                    std::vector<TileCoord>& changed);
+}  // namespace rl
+
+#endif  // GAME_PATH_PATH_GRID_H_
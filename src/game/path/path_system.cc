@@ -0,0 +1,318 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "path_system.h"
+////////////////////////////////////////////////////////////////////////////////
+
+#include "engine/core/log.h"
+#include "engine/core/vector.h"
+#include "game/world/tile_system.h"
+
+namespace rl {
+PathSystem& PathSystem::instance() {
+  static PathSystem inst;
+  return inst;
+}
+
+void PathSystem::init() {
+  RL_LOG_DEBUG("PathSystem::init");
+  constexpr auto kRequestCapacity = 128;
+  hRequestPool_.clear();
+  hRequestPool_.reserve(kRequestCapacity);
+  requests_.reserve(kRequestCapacity);
+  queue_.reserve(kRequestCapacity);
+  cache_.reserve(kCacheCapacity_);
+  head_ = 0;
+  clock_ = 0;
+  stats_ = {};
+}
+
+void PathSystem::shutdown() {
+  RL_LOG_DEBUG("PathSystem::shutdown");
+  hRequestPool_.clear();
+  requests_.clear();
+  queue_.clear();
+  cache_.clear();
+  maps_.clear();
+  head_ = 0;
+  clock_ = 0;
+  stats_ = {};
+}
+
+void PathSystem::save(SnapshotWriter& w) const {
+  hRequestPool_.save(w);
+  w.write(static_cast<u32>(requests_.size()));
+
+  for (const auto& req : requests_) {
+    w.write(req.handle);
+    w.write(req.set);
+    w.write(req.start);
+    w.write(req.goal);
+    w.write(req.status);
+    w.write(req.path);
+    w.write(req.waypoints);
+    w.write(req.refined);
+  }
+
+  w.write(queue_);
+  w.write(static_cast<u64>(head_));
+  w.write(static_cast<u32>(cache_.size()));
+
+  for (const auto& e : cache_) {
+    w.write(e.set);
+    w.write(e.revision);
+    w.write(e.start);
+    w.write(e.goal);
+    w.write(e.used);
+    w.write(e.status);
+    w.write(e.path);
+    w.write(e.waypoints);
+  }
+
+  w.write(clock_);
+}
+
+bool PathSystem::restore(SnapshotReader& r) {
+  u32 count{0};
+  if (!hRequestPool_.restore(r) || !r.read(count)) return false;
+  requests_.resize(count);
+
+  for (auto& req : requests_) {
+    auto ok = r.read(req.handle) && r.read(req.set) && r.read(req.start) &&
+              r.read(req.goal) && r.read(req.status) && r.read(req.path) &&
+              r.read(req.waypoints) && r.read(req.refined);
+    if (!ok) return false;
+  }
+
+  u64 head{0};
+  if (!r.read(queue_) || !r.read(head) || !r.read(count)) return false;
+  head_ = static_cast<usize>(head);
+  cache_.resize(count);
+
+  for (auto& e : cache_) {
+    auto ok = r.read(e.set) && r.read(e.revision) && r.read(e.start) &&
+              r.read(e.goal) && r.read(e.used) && r.read(e.status) &&
+              r.read(e.path) && r.read(e.waypoints);
+    if (!ok) return false;
+  }
+
+  return r.read(clock_);
+}
+
+void PathSystem::fixedUpdate(const FramePacket&) {
+  stats_.solved = 0;
+  stats_.cacheHits = 0;
+  stats_.hierarchical = 0;
+  stats_.expanded = 0;
+  stats_.chunksRebuilt = 0;
+  stats_.clustersRebuilt = 0;
+  usize spent = 0;
+
+  while (head_ < queue_.size() && spent < kExpansionBudget_) {
+    auto* req = request(queue_[head_++]);
+    if (!req || req->status != PathStatus::Pending) continue;
+    auto expanded = stats_.expanded;
+    solve(*req);
+    spent += std::max<usize>(stats_.expanded - expanded, 1);
+  }
+
+  if (head_ == queue_.size()) {
+    queue_.clear();
+    head_ = 0;
+  }
+
+  // What the queue left builds the graphs' queued clusters, ahead of the
+  // queries that would build them. It does not count for requests: a
+  // re-simulation finds them built already.
+  for (auto& pm : maps_) {
+    if (spent >= kExpansionBudget_) break;
+    if (!pm.hasGraph || pm.graph.built()) continue;
+    spent += pm.graph.update(pm.grid, kExpansionBudget_ - spent);
+  }
+
+  stats_.pending = queue_.size() - head_;
+}
+
+PathRequestHandle PathSystem::request(const PathRequestDesc& desc) {
+  RL_ASSERT(desc.set, "PathSystem::request: Invalid tile set handle provided!");
+  auto h = hRequestPool_.generate();
+  ensureCapacity(requests_, h.index);
+  auto& req = requests_[h.index];
+  req.handle = h;
+  req.set = desc.set;
+  req.start = desc.start;
+  req.goal = desc.goal;
+  requeue(req);
+  return h;
+}
+
+void PathSystem::release(PathRequestHandle h) {
+  auto* req = request(h);
+  if (!req) return;
+  // Still queued: fixedUpdate() skips it once the handle is dead.
+  *req = {};
+  hRequestPool_.destroy(h);
+}
+
+const PathRequest* PathSystem::result(PathRequestHandle h) const {
+  if (!h || !hRequestPool_.alive(h)) return nullptr;
+  return &requests_[h.index];
+}
+
+std::span<const TileCoord> PathSystem::corners(PathRequestHandle h,
+                                               usize count) {
+  auto* req = request(h);
+  if (!req || req->status != PathStatus::Found) return {};
+
+  while (req->path.size() < count && req->refined + 1 < req->waypoints.size()) {
+    auto* pm = pathMap(req->set);
+    const auto& from = req->waypoints[req->refined];
+    const auto& to = req->waypoints[req->refined + 1];
+
+    if (!pm || !graph(*pm).refine(pm->grid, from, to, req->path)) {
+      requeue(*req);
+      return {};
+    }
+
+    ++req->refined;
+  }
+
+  return req->path;
+}
+
+PathRequest* PathSystem::request(PathRequestHandle h) {
+  if (!h || !hRequestPool_.alive(h)) return nullptr;
+  return &requests_[h.index];
+}
+
+PathSystem::PathMap* PathSystem::pathMap(TileSetHandle h) {
+  const auto* set = RL_CTILESYS.tileset(h);
+  if (!set) return nullptr;
+  ensureCapacity(maps_, h.index);
+  auto& pm = maps_[h.index];
+
+  if (pm.set != h || pm.revision > set->revision) {
+    pm = {};
+    pm.set = h;
+    buildPathGrid(pm.grid, set->map);
+  } else if (pm.revision < set->revision) {
+    changed_.clear();
+    updatePathGrid(pm.grid, set->map,
+                   std::span{set->edits}.subspan(pm.revision), changed_);
+
+    if (pm.hasJumps) {
+      stats_.chunksRebuilt += repairJumpPointMap(pm.jumps, pm.grid, changed_);
+    }
+
+    if (pm.hasGraph) {
+      stats_.clustersRebuilt += pm.graph.repair(pm.grid, changed_);
+    }
+  }
+
+  pm.revision = set->revision;
+  return &pm;
+}
+
+const JumpPointMap& PathSystem::jumps(PathMap& pm) {
+  if (!pm.hasJumps) {
+    buildJumpPointMap(pm.jumps, pm.grid);
+    pm.hasJumps = true;
+    stats_.chunksRebuilt +=
+        static_cast<usize>(pm.jumps.chunks.x) * pm.jumps.chunks.y;
+  }
+
+  return pm.jumps;
+}
+
+PathGraph& PathSystem::graph(PathMap& pm) {
+  if (!pm.hasGraph) {
+    pm.graph.build(pm.grid);
+    pm.hasGraph = true;
+  }
+
+  return pm.graph;
+}
+
+void PathSystem::requeue(PathRequest& req) {
+  req.status = PathStatus::Pending;
+  req.path.clear();
+  req.waypoints.clear();
+  req.refined = 0;
+  queue_.push_back(req.handle);
+}
+
+void PathSystem::solve(PathRequest& req) {
+  auto* pm = pathMap(req.set);
+
+  if (!pm) {
+    req.status = PathStatus::NoPath;
+    return;
+  }
+
+  ++stats_.solved;
+  CacheEntry* slot = nullptr;
+
+  for (auto& e : cache_) {
+    if (e.set == req.set && e.revision == pm->revision &&
+        e.start == req.start && e.goal == req.goal) {
+      e.used = ++clock_;
+      req.status = e.status;
+      req.path = e.path;
+      req.waypoints = e.waypoints;
+      req.refined = 0;
+      ++stats_.cacheHits;
+      return;
+    }
+
+    if (!slot || e.used < slot->used) slot = &e;
+  }
+
+  auto span = req.goal - req.start;
+  auto far = std::max(std::abs(span.x), std::abs(span.y)) >
+             kNearClusters_ * kPathChunkSize;
+  auto found = false;
+  req.path.clear();
+  req.waypoints.clear();
+  req.refined = 0;
+
+  if (far) {
+    // Only the abstract path now: corners() refines it as it gets walked.
+    auto& g = graph(*pm);
+    found = g.find(pm->grid, req.start, req.goal, req.waypoints);
+    if (found) req.path.push_back(req.start);
+    stats_.expanded += g.expanded();
+    ++stats_.hierarchical;
+  } else {
+    found = search_.find(pm->grid, jumps(*pm), req.start, req.goal, req.path);
+    stats_.expanded += search_.expanded();
+  }
+
+  req.status = found ? PathStatus::Found : PathStatus::NoPath;
+  if (cache_.size() < kCacheCapacity_) slot = &cache_.emplace_back();
+  slot->set = req.set;
+  slot->revision = pm->revision;
+  slot->start = req.start;
+  slot->goal = req.goal;
+  slot->used = ++clock_;
+  slot->status = req.status;
+  slot->path = req.path;
+  slot->waypoints = req.waypoints;
+}
+}  // namespace rl
@@ -0,0 +1,124 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef GAME_PATH_PATH_SYSTEM_H_
+#define GAME_PATH_PATH_SYSTEM_H_
+
+#include "engine/common.h"
+#include "engine/core/frame.h"
+#include "engine/core/handle.h"
+#include "engine/snapshot/snapshot.h"
+#include "game/path/jump_point_map.h"
+#include "game/path/jump_point_search.h"
+#include "game/path/path.h"
+#include "game/path/path_graph.h"
+#include "game/path/path_grid.h"
+
+namespace rl {
+struct PathStats {
+  usize pending{0};
+  usize solved{0};  // This tick, cache hits included.
+  usize cacheHits{0};
+  usize hierarchical{0};
+  usize expanded{0};
+  usize chunksRebuilt{0};
+  usize clustersRebuilt{0};  // Queued for their distances.
+};
+
+class PathSystem {
+ public:
+  static PathSystem& instance();
+
+  void init();
+  void shutdown();
+
+  void save(SnapshotWriter& w) const;
+  bool restore(SnapshotReader& r);
+
+  // Solves queued requests in order until the tick's budget is spent, then
+  // spends the rest on the graphs' distances.
+  void fixedUpdate(const FramePacket&);
+
+  [[nodiscard]] PathRequestHandle request(const PathRequestDesc& desc);
+  void release(PathRequestHandle h);
+
+  const PathRequest* result(PathRequestHandle h) const;
+  // The path's corners, refining long paths until there are at least count
+  // of them. If the tiles no longer allow the path, it is queued again and
+  // this returns nothing.
+  std::span<const TileCoord> corners(PathRequestHandle h, usize count);
+  const PathStats& stats() const noexcept { return stats_; }
+
+ private:
+  // Nodes expanded per tick before the queue waits for the next one. Counted
+  // in nodes rather than time so a rollback re-simulation solves the same
+  // requests on the same tick.
+  inline static constexpr usize kExpansionBudget_ = 8192;
+  inline static constexpr usize kCacheCapacity_ = 64;
+  // Queries further apart than this many chunks on an axis search the HPA*
+  // graph rather than JPS+.
+  inline static constexpr TileUnit kNearClusters_ = 2;
+
+  // Derived from a tile set, so not part of a snapshot. Jump points and the
+  // graph are only built once a query needs them, and the graph's distances
+  // a cluster at a time: see fixedUpdate().
+  struct PathMap {
+    TileSetHandle set{kInvalidHandle};
+    u32 revision{0};
+    PathGrid grid{};
+    bool hasJumps{false};
+    JumpPointMap jumps{};
+    bool hasGraph{false};
+    PathGraph graph{};
+  };
+
+  struct CacheEntry {
+    TileSetHandle set{kInvalidHandle};
+    u32 revision{0};
+    TileCoord start{};
+    TileCoord goal{};
+    u64 used{0};
+    PathStatus status{PathStatus::Pending};
+    std::vector<TileCoord> path{};
+    std::vector<TileCoord> waypoints{};
+  };
+
+  HandlePool<PathRequestTag> hRequestPool_{};
+  std::vector<PathRequest> requests_{};
+  std::vector<PathRequestHandle> queue_{};
+  usize head_{0};
+  std::vector<CacheEntry> cache_{};
+  u64 clock_{0};
+  std::vector<PathMap> maps_{};
+  std::vector<TileCoord> changed_{};
+  JumpPointSearch search_{};
+  PathStats stats_{};
+
+  PathSystem() = default;
+
+  PathRequest* request(PathRequestHandle h);
+  PathMap* pathMap(TileSetHandle h);
+  const JumpPointMap& jumps(PathMap& pm);
+  PathGraph& graph(PathMap& pm);
+  void requeue(PathRequest& req);
+  void solve(PathRequest& req);
+};
+}  // namespace rl
+
+#define RL_PATHSYS (::rl::PathSystem::instance())
+#define RL_CPATHSYS \
+  (static_cast<const ::rl::PathSystem&>(::rl::PathSystem::instance()))
+
+#endif  // GAME_PATH_PATH_SYSTEM_H_
@@ -0,0 +1,97 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Precompiled. ////////////////////////////////////////////////////////////////
+#include "precompiled.h"
+////////////////////////////////////////////////////////////////////////////////
+
+// Header. /////////////////////////////////////////////////////////////////////
+#include "tile_query.h"
+////////////////////////////////////////////////////////////////////////////////
+
+#include "game/world/tile_utils.h"
+
+namespace rl {
+namespace internal {
+bool blocksAt(const TileSet& set, TileCoord c) {
+  if (c.x < 0 || c.y < 0) return true;
+  return set.map.blocks(static_cast<u16>(c.x), static_cast<u16>(c.y));
+}
+}  // namespace internal
+
+bool raycastTiles(const TileSet& set, Position from, Position to,
+                  TileRayHit& hit) {
+  hit = {};
+  auto d = to - from;
+  auto c = tileAt(set, from);
+  auto last = tileAt(set, to);
+
+  // Per axis: the step between cells, the t of the next cell border and the
+  // t between two borders.
+  TileCoord step{d.x > .0f ? 1 : -1, d.y > .0f ? 1 : -1};
+  auto inf = std::numeric_limits<f32>::infinity();
+  auto border = [&](f32 p, f32 dp, f32 origin, TileUnit cell, TileUnit s) {
+    if (almostZero(dp)) return inf;
+    auto edge = origin + static_cast<f32>(cell + (s > 0 ? 1 : 0)) *
+                             kTileSizeF32;
+    return (edge - p) / dp;
+  };
+
+  auto nextX = border(from.x, d.x, set.offset.x, c.x, step.x);
+  auto nextY = border(from.y, d.y, set.offset.y, c.y, step.y);
+  auto deltaX = almostZero(d.x) ? inf : kTileSizeF32 / std::abs(d.x);
+  auto deltaY = almostZero(d.y) ? inf : kTileSizeF32 / std::abs(d.y);
+  auto t = .0f;
+
+  for (;;) {
+    if (internal::blocksAt(set, c)) {
+      hit.tile = c;
+      hit.t = t;
+      hit.point = from + d * t;
+      return true;
+    }
+
+    if (c == last) return false;
+
+    if (nextX < nextY) {
+      t = nextX;
+      nextX += deltaX;
+      c.x += step.x;
+    } else {
+      t = nextY;
+      nextY += deltaY;
+      c.y += step.y;
+    }
+
+    if (t > 1.0f) return false;
+  }
+}
+
+usize blockingTilesIn(const TileSet& set, const Aabb& a,
+                      std::span<TileCoord> out) {
+  auto min = tileAt(set, a.center - a.halfExtents);
+  auto max = tileAt(set, a.center + a.halfExtents);
+  usize count = 0;
+
+  for (auto y = min.y; y <= max.y; ++y) {
+    for (auto x = min.x; x <= max.x; ++x) {
+      if (count == out.size()) return count;
+      if (internal::blocksAt(set, {x, y})) out[count++] = {x, y};
+    }
+  }
+
+  return count;
+}
+}  // namespace rl
@@ -0,0 +1,42 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef GAME_WORLD_TILE_QUERY_H_
+#define GAME_WORLD_TILE_QUERY_H_
+
+#include "engine/common.h"
+#include "engine/physics/collider.h"
+#include "engine/transform/transform.h"
+#include "game/world/tile.h"
+#include "game/world/tile_set.h"
+
+namespace rl {
+struct TileRayHit {
+  TileCoord tile{};
+  f32 t{1.0f};  // Along the segment, from 0 to 1.
+  Position point{};
+};
+
+// First blocking cell the segment from -> to enters, walking the cells it
+// crosses in order. Cells off the map block, as in TileMap::blocks.
+[[nodiscard]] bool raycastTiles(const TileSet& set, Position from, Position to,
+                                TileRayHit& hit);
+// Fills out with the blocking cells under a, row by row, and returns how many
+// were written.
+usize blockingTilesIn(const TileSet& set, const Aabb& a,
+                      std::span<TileCoord> out);
+}  // namespace rl
+
+#endif  // GAME_WORLD_TILE_QUERY_H_
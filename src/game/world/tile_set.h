@@ -18,6 +18,7 @@
 
 #include "engine/common.h"
 #include "engine/core/handle.h"
+#include "engine/physics/static_grid.h"
 #include "engine/transform/transform.h"
 #include "game/world/tile_map.h"
 
@@ -34,6 +35,11 @@ struct TileSet {
   TileSetHandle handle{kInvalidHandle};
   Position offset{};
   TileMap map{};
+  u32 revision{0};  // Bumped on every tile kind edit.
+  // Edited cells in order: edits[i] moved the revision from i to i + 1.
+  std::vector<TileCoord> edits{};
+  // Impassable tiles, for physics bodies to collide with.
+  StaticGridHandle collision{kInvalidHandle};
 };
 }  // namespace rl
 
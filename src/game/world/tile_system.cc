@@ -25,6 +25,7 @@
 #include "engine/camera/camera_system.h"
 #include "engine/core/log.h"
 #include "engine/core/vector.h"
+#include "engine/physics/physics_system.h"
 #include "engine/render/render_submit.h"
 #include "engine/texture/texture_library.h"
 
@@ -103,11 +104,30 @@ TileSetHandle TileSystem::generate(const TileSetDesc& desc) {
   a.handle = h;
   a.offset = desc.offset;
   a.map = desc.map;
+
+  const auto& map = a.map;
+  a.collision = RL_PHYSICSSYS.generateStaticGrid({
+      .origin = a.offset,
+      .cellSize = kTileSizeF32,
+      .width = static_cast<u16>(map.extent.x),
+      .height = static_cast<u16>(map.extent.y),
+  });
+
+  for (TileUnit y = 0; y < map.extent.y; ++y) {
+    for (TileUnit x = 0; x < map.extent.x; ++x) {
+      if (map.at(x, y).passable()) continue;
+      RL_PHYSICSSYS.solid(a.collision, static_cast<u16>(x),
+                          static_cast<u16>(y), true);
+    }
+  }
+
   return h;
 }
 
 void TileSystem::destroy(TileSetHandle h) {
   auto* set = tileset(h);
+  if (!set) return;
+  if (set->collision) RL_PHYSICSSYS.destroyStaticGrid(set->collision);
 
   for (const auto& t : set->map.tiles) {
     if (t.vis.tex) {
@@ -130,6 +150,21 @@ TileSet* TileSystem::tileset(TileSetHandle h) {
   return &sets_[h.index];
 }
 
+void TileSystem::set(TileSetHandle h, TileCoord c, TileKind kind) {
+  auto* set = tileset(h);
+  if (!set) return;
+  auto& map = set->map;
+  RL_ASSERT(map.inBounds(c.x, c.y), "TileSystem::set: Tile out of bounds!");
+  if (!map.inBounds(c.x, c.y)) return;
+  auto& t = map.at(c.x, c.y);
+  if (t.kind == kind) return;
+  t.kind = kind;
+  RL_PHYSICSSYS.solid(set->collision, static_cast<u16>(c.x),
+                      static_cast<u16>(c.y), !t.passable());
+  set->edits.push_back(c);
+  ++set->revision;
+}
+
 const TileSet* TileSystem::tileset(TileSetHandle h) const {
   RL_ASSERT(h && hSetPool_.alive(h),
             "TileSystem::tileset: Invalid tile set handle provided!");
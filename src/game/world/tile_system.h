@@ -36,6 +36,9 @@ class TileSystem {
   TileSet* tileset(TileSetHandle h);
   const TileSet* tileset(TileSetHandle h) const;
 
+  // Kind edits go through here so passability users see the revision move.
+  void set(TileSetHandle h, TileCoord c, TileKind kind);
+
  private:
   HandlePool<TileSetTag> hSetPool_{};
   std::vector<TileSet> sets_{};
@@ -0,0 +1,39 @@
+// Copyright 2025 m4jr0. All Rights Reserved.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef GAME_WORLD_TILE_UTILS_H_
+#define GAME_WORLD_TILE_UTILS_H_
+
+#include "engine/common.h"
+#include "engine/transform/transform.h"
+#include "game/world/tile.h"
+#include "game/world/tile_set.h"
+
+namespace rl {
+// Cell of set holding pos. May lie outside the map.
+[[nodiscard]] inline TileCoord tileAt(const TileSet& set, const Position& pos) {
+  return {
+      static_cast<TileUnit>(std::floor((pos.x - set.offset.x) / kTileSizeF32)),
+      static_cast<TileUnit>(std::floor((pos.y - set.offset.y) / kTileSizeF32)),
+  };
+}
+
+[[nodiscard]] inline Position tileCenter(const TileSet& set, TileCoord c) {
+  return {set.offset.x + (static_cast<f32>(c.x) + .5f) * kTileSizeF32,
+          set.offset.y + (static_cast<f32>(c.y) + .5f) * kTileSizeF32};
+}
+}  // namespace rl
+
+#endif  // GAME_WORLD_TILE_UTILS_H_
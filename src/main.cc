@@ -17,9 +17,81 @@
 #include "precompiled.h"
 ////////////////////////////////////////////////////////////////////////////////
 
+#include "engine/core/engine.h"
+#include "game/ability/ability_bench.h"
 #include "game/game.h"
+#include "game/path/path_bench.h"
 
-int main() {
-  RL_GAME.run();
+int main(int argc, char** argv) {
+  rl::EngineDesc desc{};
+  auto ticksSet = false;
+
+  auto hasValue = [&](int i) { return i + 1 < argc && argv[i + 1][0] != '-'; };
+
+  auto parseU64 = [](const char* str, rl::u64& out) {
+    char* end = nullptr;
+    auto v = std::strtoull(str, &end, 10);
+    if (!end || *end != '\0') return false;
+    out = static_cast<rl::u64>(v);
+    return true;
+  };
+
+  // Usage: [--headless [ticks]] [--seed n] [--record file | --replay file]
+  //        [--rollback [latency ms] [--jitter ms] [--loss percent]]
+  //        [--bench-abilities [vm count]] [--bench-paths [query count]].
+  for (int i = 1; i < argc; ++i) {
+    std::string_view arg{argv[i]};
+
+    if (arg == "--bench-abilities") {
+      rl::u64 count{10000};
+      if (hasValue(i)) parseU64(argv[++i], count);
+      rl::runAbilityBench(static_cast<rl::usize>(count));
+      return EXIT_SUCCESS;
+    } else if (arg == "--bench-paths") {
+      rl::u64 count{10000};
+      if (hasValue(i)) parseU64(argv[++i], count);
+      rl::runPathBench(static_cast<rl::usize>(count));
+      rl::runHierarchicalPathBench(static_cast<rl::usize>(count));
+      return EXIT_SUCCESS;
+    } else if (arg == "--headless") {
+      desc.mode = rl::EngineMode::Headless;
+      rl::u64 ticks{0};
+
+      if (hasValue(i) && parseU64(argv[i + 1], ticks) && ticks > 0) {
+        desc.headlessTicks = static_cast<rl::Frame>(ticks);
+        ticksSet = true;
+        ++i;
+      }
+    } else if (arg == "--seed" && hasValue(i)) {
+      parseU64(argv[++i], desc.seed);
+    } else if (arg == "--record" && hasValue(i)) {
+      desc.recordPath = argv[++i];
+    } else if (arg == "--replay" && hasValue(i)) {
+      desc.replayPath = argv[++i];
+    } else if (arg == "--rollback") {
+      desc.rollback.enabled = true;
+      rl::u64 ms{0};
+
+      if (hasValue(i) && parseU64(argv[i + 1], ms)) {
+        desc.rollback.link.latency = static_cast<rl::f64>(ms) / 1000.0;
+        ++i;
+      }
+    } else if (arg == "--jitter" && hasValue(i)) {
+      rl::u64 ms{0};
+      parseU64(argv[++i], ms);
+      desc.rollback.link.jitter = static_cast<rl::f64>(ms) / 1000.0;
+    } else if (arg == "--loss" && hasValue(i)) {
+      rl::u64 percent{0};
+      parseU64(argv[++i], percent);
+      desc.rollback.link.loss = static_cast<rl::f32>(percent) / 100.0f;
+    }
+  }
+
+  // Case: a headless replay runs to the end of the stream unless capped.
+  if (!desc.replayPath.empty() && !ticksSet) {
+    desc.headlessTicks = static_cast<rl::Frame>(-1);
+  }
+
+  RL_GAME.run(desc);
   return EXIT_SUCCESS;
-}
\ No newline at end of file
+}
@@ -104,14 +104,28 @@ class AbilityInstructionModel:
     params: Sequence[int]
 
 
+class AbilityFactFlagBits(IntEnum):
+    NONE = 0x0
+    ANIM_BOUND = 0x1
+    ALL = 0xFF
+
+
+@dataclass(slots=True)
+class AbilityProgramFactsModel:
+    ticks: int = 0
+    flags: int = AbilityFactFlagBits.NONE
+    hitbox_ticks: list[int] = field(default_factory=list)
+
+
 @dataclass(slots=True)
 class AbilityProgramModel:
     code: list[AbilityInstructionModel] = field(default_factory=list)
+    facts: AbilityProgramFactsModel = field(default_factory=AbilityProgramFactsModel)
 
 
 @dataclass(slots=True)
 class AbilityResourceModel:
-    VERSION: ClassVar[int] = 1
+    VERSION: ClassVar[int] = 2
 
     rid: int
 
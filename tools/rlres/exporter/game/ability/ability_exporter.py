@@ -33,6 +33,13 @@ from rlres.data.game.ability.ability_type import (
 )
 
 from rlres.exporter.asset_exporter import AssetExporter
+
+from rlres.exporter.game.ability.ability_optimizer import (
+    compute_program_facts,
+    optimize_program,
+    verify_program,
+)
+
 from rlres.exporter.game.ability.ability_serialize import write_ability_file
 from rlres.logger import LOGGER
 
@@ -217,4 +224,19 @@ class AbilityExporter(AssetExporter):
                 )
             )
 
-        return AbilityProgramModel(code=code)
+        prog = AbilityProgramModel(code=code)
+        prog_name = f"{entry.name}.{key}"
+
+        if not verify_program(prog, prog_name):
+            LOGGER.error(
+                "%s: ability %r program %s is invalid; exporting it empty.",
+                cls_name,
+                entry.name,
+                key,
+            )
+
+            prog = AbilityProgramModel()
+
+        prog = optimize_program(prog)
+        prog.facts = compute_program_facts(prog)
+        return prog
@@ -0,0 +1,159 @@
+# Copyright 2025 m4jr0. All Rights Reserved.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+from __future__ import annotations
+
+import math
+
+from rlres.data.engine.anim.anim_id import AnimId
+
+from rlres.data.game.ability.ability_program import AbilityOp
+
+from rlres.data.game.ability.ability_type import (
+    AbilityFactFlagBits,
+    AbilityInstructionModel,
+    AbilityProgramFactsModel,
+    AbilityProgramModel,
+)
+
+from rlres.logger import LOGGER
+from rlres.utils.serialize_utils import bits_to_f32
+
+# Mirror engine/core/frame.h and game/ability/ability_program.h.
+FIXED_STEP: float = 1.0 / 60.0
+MAX_OPS_PER_FRAME: int = 16
+MAX_PC: int = 0xFFFF
+
+_SLEEP_EPSILON: float = 1e-4
+
+# Setters whose effect a directly following setter of the same op replaces.
+_OVERWRITING_SETTERS: frozenset[int] = frozenset(
+    (AbilityOp.SET_ANIM_SPEED, AbilityOp.SET_GCD, AbilityOp.SET_CD)
+)
+
+
+def _param(inst: AbilityInstructionModel, i: int) -> int:
+    return inst.params[i] if i < len(inst.params) else 0
+
+
+def _param_f32(inst: AbilityInstructionModel, i: int) -> float:
+    return bits_to_f32(_param(inst, i))
+
+
+def sleep_ticks(seconds: float) -> int:
+    # Case: a sleeper resumes on the tick after its timer runs out.
+    ticks = math.ceil(seconds / FIXED_STEP - _SLEEP_EPSILON)
+    return max(0, ticks) + 1
+
+
+def verify_program(prog: AbilityProgramModel, name: str) -> bool:
+    if len(prog.code) > MAX_PC:
+        LOGGER.error(
+            "ability program %s has %d ops, more than its pc can address",
+            name,
+            len(prog.code),
+        )
+
+        return False
+
+    valid_ops = {int(op) for op in AbilityOp}
+
+    for pc, inst in enumerate(prog.code):
+        if inst.op not in valid_ops:
+            LOGGER.error(
+                "ability program %s has invalid op %r at pc %d",
+                name,
+                inst.op,
+                pc,
+            )
+
+            return False
+
+        if inst.op in (AbilityOp.PLAY_ANIM, AbilityOp.WAIT_ANIM):
+            if _param(inst, 0) == AnimId.INVALID:
+                LOGGER.warn("ability program %s has no anim at pc %d", name, pc)
+        elif inst.op == AbilityOp.SET_ANIM_SPEED:
+            if _param_f32(inst, 0) <= 0.0:
+                LOGGER.warn(
+                    "ability program %s has non-positive speed at pc %d",
+                    name,
+                    pc,
+                )
+
+    return True
+
+
+def optimize_program(prog: AbilityProgramModel) -> AbilityProgramModel:
+    out: list[AbilityInstructionModel] = []
+
+    for inst in prog.code:
+        if inst.op == AbilityOp.NO_OP:
+            continue
+
+        if inst.op == AbilityOp.SLEEP and _param_f32(inst, 0) <= 0.0:
+            continue
+
+        if inst.op in _OVERWRITING_SETTERS and out and out[-1].op == inst.op:
+            out[-1] = inst
+            continue
+
+        out.append(inst)
+
+        # Case: nothing after an end is reachable. It is kept, since unlike
+        # running out of code it leaves the hitbox alive.
+        if inst.op == AbilityOp.END:
+            break
+
+    return AbilityProgramModel(code=out)
+
+
+def compute_program_facts(prog: AbilityProgramModel) -> AbilityProgramFactsModel:
+    # Walks the program the way the engine's ability runner steps it.
+    facts = AbilityProgramFactsModel()
+    budget = MAX_OPS_PER_FRAME
+    played: set[int] = set()
+
+    def yield_ticks(ticks: int) -> None:
+        nonlocal budget
+        facts.ticks += ticks
+        budget = MAX_OPS_PER_FRAME
+
+    for inst in prog.code:
+        if budget == 0:
+            yield_ticks(1)
+
+        budget -= 1
+
+        if inst.op == AbilityOp.SLEEP:
+            seconds = _param_f32(inst, 0)
+
+            if seconds > 0.0:
+                yield_ticks(sleep_ticks(seconds))
+        elif inst.op == AbilityOp.PLAY_ANIM:
+            played.add(_param(inst, 0))
+        elif inst.op == AbilityOp.WAIT_ANIM:
+            facts.flags |= AbilityFactFlagBits.ANIM_BOUND
+
+            # Case: an anim this program played holds it at least a tick, and
+            # the wait runs again on the tick it passes.
+            if _param(inst, 0) in played:
+                yield_ticks(1)
+                budget -= 1
+        elif inst.op in (AbilityOp.SPAWN_HITBOX, AbilityOp.SPAWN_STICKY_HITBOX):
+            facts.hitbox_ticks.append(facts.ticks)
+        elif inst.op == AbilityOp.END:
+            break
+
+    return facts
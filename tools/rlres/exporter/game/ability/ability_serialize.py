@@ -30,6 +30,8 @@ from rlres.utils.serialize_utils import (
     write_file_header,
     write_u32,
     write_u64,
+    write_u8,
+    write_vector_len,
 )
 
 
@@ -53,6 +55,13 @@ def write_program(f: BinaryIO, prog: AbilityProgramModel) -> None:
         write_u32(f, inst.op)
         write_param_set(f, inst.params)
 
+    write_u32(f, prog.facts.ticks)
+    write_u8(f, prog.facts.flags)
+    write_vector_len(f, len(prog.facts.hitbox_ticks))
+
+    for tick in prog.facts.hitbox_ticks:
+        write_u32(f, tick)
+
 
 def write_ability_resource(f: BinaryIO, model: AbilityResourceModel) -> None:
     write_u32(f, model.rid)
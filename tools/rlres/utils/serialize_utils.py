@@ -164,3 +164,7 @@ def read_file_header(f: BinaryIO) -> tuple[int, int, int]:
 
 def f32_to_bits(value: float) -> int:
     return _U32.unpack(_F32.pack(float(value)))[0]
+
+
+def bits_to_f32(bits: int) -> float:
+    return _F32.unpack(_U32.pack(bits & 0xFFFFFFFF))[0]